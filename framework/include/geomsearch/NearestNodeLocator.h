@@ -57,6 +57,12 @@ public:
    */
   std::vector<dof_id_type> & slaveNodes() { return _slave_nodes; }
 
+  /**
+   * Returns the number of times the patches (the master nodes searched for the nearest node of
+   * each slave node) have been built or updated.
+   */
+  unsigned int patchUpdateCount() const { return _patch_update_count; }
+
   /**
    * Returns the NodeIdRange of slave nodes to be used for calling threaded
    * functions operating on the slave nodes.
@@ -116,6 +122,9 @@ public:
 
   // The list of ghosted elements added during a time step for iteration patch update strategy
   std::vector<dof_id_type> _new_ghosted_elems;
+
+  // Number of times the patches have been built or updated
+  unsigned int _patch_update_count;
 };
 
 #endif // NEARESTNODELOCATOR_H
@@ -87,6 +87,13 @@ public:
   void setNormalSmoothingMethod(std::string nsmString);
   Real getTangentialTolerance() { return _tangential_tolerance; }
 
+  /**
+   * The number of times the penetration information has been updated. Objects that store
+   * data derived from the PenetrationInfo objects can compare this against a stored value
+   * to determine when that data must be recomputed.
+   */
+  unsigned int updateCount() const { return _update_count; }
+
 protected:
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
@@ -99,6 +106,7 @@ protected:
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
 
   const Moose::PatchUpdateType _patch_update_strategy; // Contact patch update strategy
+  unsigned int _update_count; // Number of times detectPenetration() has been called
 };
 
 /**
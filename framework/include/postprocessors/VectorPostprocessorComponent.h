@@ -0,0 +1,40 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VECTORPOSTPROCESSORCOMPONENT_H
+#define VECTORPOSTPROCESSORCOMPONENT_H
+
+#include "GeneralPostprocessor.h"
+
+class VectorPostprocessorComponent;
+
+template <>
+InputParameters validParams<VectorPostprocessorComponent>();
+
+/**
+ * Reports the value of one component of a vector computed by a VectorPostprocessor
+ */
+class VectorPostprocessorComponent : public GeneralPostprocessor
+{
+public:
+  VectorPostprocessorComponent(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The vector the component is taken from
+  const VectorPostprocessorValue & _vpp_values;
+
+  /// Index of the component
+  const unsigned int _vpp_index;
+};
+
+#endif /* VECTORPOSTPROCESSORCOMPONENT_H */
@@ -757,11 +757,14 @@ public:
    * Declare a new VectorPostprocessor vector
    * @param name The name of the post-processor
    * @param vector_name The name of the post-processor
+   * @param contains_complete_history True if the vector will contain the complete history
+   * @param is_distributed True if the vector is distributed across the processors
    * @return The reference to the vector declared
    */
   VectorPostprocessorValue & declareVectorPostprocessorVector(const VectorPostprocessorName & name,
                                                               const std::string & vector_name,
-                                                              bool contains_complete_history);
+                                                              bool contains_complete_history,
+                                                              bool is_distributed = false);
 
   /**
    * Whether or not the specified VectorPostprocessor has declared any vectors
@@ -1101,6 +1104,13 @@ public:
 
   virtual void possiblyRebuildGeomSearchPatches();
 
+  /**
+   * Rebuild the sparse communication plans of the remote dofs requested from the nonlinear and
+   * auxiliary systems (see SystemBase::addRemoteDofs()).  Only communicates when a plan changed on
+   * some processor.
+   */
+  void updateRemoteDofPlans();
+
   virtual GeometricSearchData & geomSearchData() override { return _geometric_search_data; }
 
   /**
@@ -1531,6 +1541,9 @@ protected:
    */
   void meshChangedHelper(bool intermediate_change = false);
 
+  /// Whether the geometric search patches on the displaced mesh may be updated with every Jacobian
+  bool displacedPatchesUpdatedInJacobian() const;
+
   /// Helper to check for duplicate variable names across systems or within a single system
   bool duplicateVariableCheck(const std::string & var_name, const FEType & type, bool is_aux);
 
@@ -1592,6 +1605,9 @@ protected:
   /// Indicates if the Jacobian was computed
   bool _has_jacobian;
 
+  /// Whether the geometric search or the mesh changed since the remote dof plans were last updated
+  bool _remote_dof_plans_outdated;
+
   /// Indicates that we need to compute variable values for previous Newton iteration
   bool _needs_old_newton_iter;
 
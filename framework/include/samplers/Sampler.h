@@ -37,6 +37,11 @@ InputParameters validParams<Sampler>();
  * Samplers support the use of "execute_on", which when called results in new set of random numbers,
  * thus after execute() runs the getSamples() method will now produces a new set of random numbers
  * from calls prior to the execute() call.
+ *
+ * When "parallel_type = DISTRIBUTED" is used the samples are computed one entry at a time by the
+ * computeSample method, using random numbers that depend only on the seed and the location of the
+ * entry. The samples are then identical for any number of processors and each processor is able to
+ * compute only the rows that it requires (see getLocalSamples and getSampleRow).
  */
 class Sampler : public MooseObject, public SetupInterface, public DistributionInterface
 {
@@ -122,6 +127,39 @@ public:
    */
   unsigned int getTotalNumberOfRows();
 
+  /**
+   * Return true if the samples are computed by row rather than built on every processor.
+   */
+  bool isDistributed() const { return _distributed; }
+
+  /**
+   * Return the number of calls to execute(), which changes whenever new samples are created.
+   */
+  unsigned int getExecuteCount() const { return _execute_count; }
+
+  /**
+   * Return a single row of the samples.
+   * @param global_index The global row, see getLocation.
+   *
+   * For a distributed Sampler only the requested row is computed, otherwise the complete set of
+   * samples is created.
+   */
+  std::vector<Real> getSampleRow(unsigned int global_index);
+
+  /**
+   * Return the rows of the samples assigned to this processor, which are the global rows in the
+   * range [getLocalRowBegin(), getLocalRowEnd()).
+   */
+  DenseMatrix<Real> getLocalSamples();
+
+  ///@{
+  /**
+   * Return the range of global rows assigned to this processor.
+   */
+  unsigned int getLocalRowBegin();
+  unsigned int getLocalRowEnd();
+  ///@}
+
 protected:
   /**
    * Get the next random number from the generator.
@@ -139,6 +177,33 @@ protected:
    */
   virtual std::vector<DenseMatrix<Real>> sample() = 0;
 
+  /**
+   * Base class must override this method to support "parallel_type = DISTRIBUTED".
+   * @param matrix_index The index of the DenseMatrix
+   * @param row_index The row within the DenseMatrix
+   * @param col_index The column within the DenseMatrix (i.e., the distribution index)
+   * @return The sample value, which must be computed using the counterRand method.
+   */
+  virtual Real
+  computeSample(unsigned int matrix_index, unsigned int row_index, unsigned int col_index);
+
+  /**
+   * Base class must override this method to support "parallel_type = DISTRIBUTED".
+   * @return The number of rows in each of the DenseMatrix objects.
+   */
+  virtual std::vector<unsigned int> sampleRowCounts();
+
+  /**
+   * Get a random number for an entry of the samples without using the generator state.
+   * @param index The index of the seed, see setNumberOfRequiedRandomSeeds.
+   * @param row_index The row within the DenseMatrix
+   * @param col_index The column within the DenseMatrix
+   *
+   * @return A double in the interval (0, 1) that depends only on the seed, the inputs, and the
+   *         number of calls to execute().
+   */
+  double counterRand(unsigned int index, unsigned int row_index, unsigned int col_index) const;
+
   /**
    * Set the number of seeds required by the sampler. The Sampler will generate
    * additional seeds as needed. This function should be called in the constructor
@@ -153,6 +218,12 @@ protected:
    */
   void reinit(const std::vector<DenseMatrix<Real>> & data);
 
+  /**
+   * Reinitialize the offsets and row counts.
+   * @param row_counts The number of rows in each DenseMatrix
+   */
+  void reinit(const std::vector<unsigned int> & row_counts);
+
   /// Map used to store the perturbed parameters and their corresponding distributions
   std::vector<Distribution *> _distributions;
 
@@ -163,6 +234,17 @@ protected:
   std::vector<std::string> _sample_names;
 
 private:
+  /**
+   * Compute the offsets and row counts, if they do not exist.
+   */
+  void initRowCounts();
+
+  /// Flag for computing the samples by row
+  const bool _distributed;
+
+  /// Number of calls to execute(), which is included in the counter based random numbers
+  unsigned int _execute_count;
+
   /// Random number generator, don't give users access we want to control it via the interface
   /// from this class.
   MooseRandom _generator;
@@ -178,6 +260,10 @@ private:
 
   /// Total number of rows
   unsigned int _total_rows;
+
+  /// The range of global rows assigned to this processor
+  unsigned int _local_row_begin;
+  unsigned int _local_row_end;
 };
 
 #endif /* SAMPLER_H */
@@ -75,6 +75,19 @@ public:
     return _undisplaced_system.serializedSolution();
   }
 
+  virtual void setRemoteDofs(const std::string & requester,
+                             const std::vector<dof_id_type> & dofs) override
+  {
+    _undisplaced_system.setRemoteDofs(requester, dofs);
+  }
+
+  virtual void clearRemoteDofs() override { _undisplaced_system.clearRemoteDofs(); }
+
+  virtual const NumericVector<Number> & remoteSolution() override
+  {
+    return _undisplaced_system.remoteSolution();
+  }
+
   virtual const NumericVector<Number> *& currentSolution() override
   {
     return _undisplaced_system.currentSolution();
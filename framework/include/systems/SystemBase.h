@@ -23,6 +23,7 @@
 #include "libmesh/equation_systems.h"
 #include "libmesh/numeric_vector.h"
 #include "libmesh/sparse_matrix.h"
+#include "libmesh/threads.h"
 
 // Forward declarations
 class Factory;
@@ -282,6 +283,48 @@ public:
    */
   virtual NumericVector<Number> & serializedSolution() = 0;
 
+  /**
+   * Register degrees of freedom whose current values are needed on this processor even though they
+   * may be owned by (and not ghosted from) another processor.  Unlike serializedSolution(), only
+   * the requested entries are communicated, and only with the processors that own them.  The
+   * requests of a requester replace its previous requests, and all requests are discarded when the
+   * mesh changes, at which point they must be registered again (e.g. from
+   * MeshChangedInterface::meshChanged()).  New requests become available through remoteSolution()
+   * once the problem rebuilds the communication plan, which happens after initialSetup(), after
+   * mesh changes and after geometric search updates and patch rebuilds (i.e. requests made from
+   * Material::residualSetup() or Material::jacobianSetup() at those points are honored for that
+   * evaluation).
+   *
+   * @param requester Name identifying the requesting object
+   * @param dofs Global dof indices to make available through remoteSolution()
+   */
+  virtual void setRemoteDofs(const std::string & requester, const std::vector<dof_id_type> & dofs);
+
+  /**
+   * Discard all registered remote dof requests
+   */
+  virtual void clearRemoteDofs();
+
+  /**
+   * Ghosted solution vector holding the local entries plus all dofs registered through
+   * setRemoteDofs().  The values are refreshed each time the solution of this system is updated.
+   * If no processor registered any remote dofs this is the current solution.
+   */
+  virtual const NumericVector<Number> & remoteSolution();
+
+  /**
+   * Rebuild the sparse communication plan for the registered remote dofs if the set of requested
+   * dofs or the dof distribution changed on any processor.  This must be called on all
+   * processors.
+   */
+  virtual void updateRemoteDofPlan();
+
+  /**
+   * Refresh the values of the registered remote dofs from the given (parallel) vector.  This does
+   * not communicate at all unless some processor registered remote dofs.
+   */
+  virtual void updateRemoteSolution(const NumericVector<Number> & source);
+
   virtual NumericVector<Number> & residualCopy()
   {
     mooseError("This system does not support getting a copy of the residual");
@@ -685,6 +728,17 @@ protected:
   Moose::VarKindType _var_kind;
 
   std::vector<VarCopyInfo> _var_to_copy;
+
+  /// Sorted remote dofs requested by each object through setRemoteDofs() (without local dofs)
+  std::map<std::string, std::vector<dof_id_type>> _remote_dofs;
+  /// Sorted list of ghost entries of _remote_solution (the sparse communication plan)
+  std::vector<dof_id_type> _remote_dof_send_list;
+  /// Whether the requested remote dofs changed since the plan was last built
+  bool _remote_dofs_changed;
+  /// Local solution plus the requested remote dofs
+  std::unique_ptr<NumericVector<Number>> _remote_solution;
+  /// Mutex protecting _remote_dofs from concurrent requests by threaded objects
+  Threads::spin_mutex _remote_dofs_mutex;
 };
 
 #define PARALLEL_TRY
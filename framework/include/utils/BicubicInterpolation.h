@@ -21,6 +21,11 @@
  * As a result, this bicubic interpolation can be much faster than the bicubic
  * spline interpolation method in BicubicSplineInterpolation.
  *
+ * The coefficients of each cell are stored contiguously, so that a sample only
+ * touches a single block of memory. If the independent values in a direction are
+ * (approximately) uniformly or logarithmically spaced, the cell containing a point is
+ * found directly rather than by a binary search.
+ *
  * Adapted from Numerical Recipes in C (section 3.6). The terminology used is
  * consistent with that used in Numerical Recipes, where moving over a column
  * corresponds to moving over the x1 coord. Likewise, moving over a row means
@@ -43,7 +48,7 @@ public:
   /**
    * Samples value at point (x1, x2)
    */
-  Real sample(Real x1, Real x2);
+  Real sample(Real x1, Real x2) const;
 
   /**
    * Samples value and first derivatives at point (x1, x2)
@@ -51,17 +56,17 @@ public:
    * as it minimizes the amount of time spent locating the point in the
    * tabulated data
    */
-  void sampleValueAndDerivatives(Real x1, Real x2, Real & y, Real & dy1, Real & dy2);
+  void sampleValueAndDerivatives(Real x1, Real x2, Real & y, Real & dy1, Real & dy2) const;
 
   /**
    * Samples first derivative at point (x1, x2)
    */
-  Real sampleDerivative(Real x1, Real x2, unsigned int deriv_var);
+  Real sampleDerivative(Real x1, Real x2, unsigned int deriv_var) const;
 
   /**
    * Samples second derivative at point (x1, x2)
    */
-  Real sample2ndDerivative(Real x1, Real x2, unsigned int deriv_var);
+  Real sample2ndDerivative(Real x1, Real x2, unsigned int deriv_var) const;
 
   /**
    * Precompute all of the coefficients for the bicubic interpolation to avoid
@@ -70,11 +75,57 @@ public:
   void precomputeCoefficients();
 
 protected:
+  /// Spacing of the independent values in one direction
+  enum class GridSpacing
+  {
+    UNIFORM,
+    LOG,
+    GENERAL
+  };
+
+  /// Data used to locate a point along one direction of the table
+  struct GridAxis
+  {
+    /// Spacing of the independent values
+    GridSpacing spacing = GridSpacing::GENERAL;
+    /// First independent value (or its logarithm for LOG spacing)
+    Real origin = 0.0;
+    /// Inverse of the average spacing (of the logarithms for LOG spacing)
+    Real inv_delta = 0.0;
+  };
+
+  /**
+   * Determines whether the independent values x are uniformly or logarithmically
+   * spaced, so that findInterval() can locate a point without searching
+   */
+  GridAxis classifyAxis(const std::vector<Real> & x) const;
+
   /**
    * Find the indices of the dependent values axis which bracket the point xi
    */
-  void findInterval(
-      const std::vector<Real> & x, Real xi, unsigned int & klo, unsigned int & khi, Real & xs);
+  void findInterval(const std::vector<Real> & x,
+                    const GridAxis & axis,
+                    Real xi,
+                    unsigned int & klo,
+                    unsigned int & khi,
+                    Real & xs) const;
+
+  /**
+   * Locates the point (x1, x2) in the table
+   * @param[out] cell index of the first coefficient of the cell containing the point
+   * @param[out] t scaled position of the point in the x1 direction
+   * @param[out] u scaled position of the point in the x2 direction
+   * @param[out] d1 size of the cell in the x1 direction
+   * @param[out] d2 size of the cell in the x2 direction
+   */
+  void locate(
+      Real x1, Real x2, std::size_t & cell, Real & t, Real & u, Real & d1, Real & d2) const;
+
+  /**
+   * Evaluates the bicubic polynomial of a cell and its derivatives wrt the scaled
+   * positions t and u using Horner's method
+   */
+  void evaluate(std::size_t cell, Real t, Real u, Real & y, Real & dy_dt, Real & dy_du) const;
 
   /**
    * Provides the values of the first derivatives in each direction at all
@@ -93,9 +144,14 @@ protected:
   /// The dependent values at (x1, x2) points
   std::vector<std::vector<Real>> _y;
 
-  /// Matrix of precomputed coefficients
-  /// There are four coefficients in each direction at each dependent value
-  std::vector<std::vector<std::vector<std::vector<Real>>>> _bicubic_coeffs;
+  /// Location data for the x1 and x2 directions
+  GridAxis _x1_axis;
+  GridAxis _x2_axis;
+
+  /// Precomputed coefficients. There are four coefficients in each direction in each
+  /// cell, stored contiguously as c[i][j] at _bicubic_coeffs[cell + 4 * i + j], where
+  /// cell = 16 * (x1l * (x2.size() - 1) + x2l)
+  std::vector<Real> _bicubic_coeffs;
 
   /// Matrix used to calculate bicubic interpolation coefficients
   /// (from Numerical Recipes)
@@ -32,6 +32,17 @@ public:
                       std::vector<std::size_t> & return_index,
                       std::vector<Real> & return_dist_sqr);
 
+  /**
+   * Find all points within a distance of a query point
+   * @param query_point the query point
+   * @param radius the search radius
+   * @param[out] indices_dist_sqr the indices of the points within the radius and their squared
+   * distances to the query point, sorted by increasing distance
+   */
+  void radiusSearch(Point & query_point,
+                    Real radius,
+                    std::vector<std::pair<std::size_t, Real>> & indices_dist_sqr);
+
   /**
    * PointListAdaptor is required to use libMesh Point coordinate type with
    * nanoflann KDTree library. The member functions within the PointListAdaptor
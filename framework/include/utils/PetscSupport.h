@@ -144,6 +144,15 @@ void colorAdjacencyMatrix(PetscScalar * adjacency_matrix,
                           std::vector<unsigned int> & vertex_colors,
                           const char * coloring_algorithm);
 
+/**
+ * Same as colorAdjacencyMatrix, but the graph is given as a list of neighboring vertices for each
+ * vertex so that large, sparse graphs never require a dense size x size array.
+ */
+void colorAdjacencyGraph(const std::vector<std::vector<unsigned int>> & adjacency_lists,
+                         unsigned int colors,
+                         std::vector<unsigned int> & vertex_colors,
+                         const char * coloring_algorithm);
+
 /**
  * Wrapper of the libmesh ComputeLineSearchObject
  */
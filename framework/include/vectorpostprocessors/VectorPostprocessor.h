@@ -55,6 +55,11 @@ public:
    */
   bool containsCompleteHistory() const { return _contains_complete_history; }
 
+  /**
+   * Return whether or not the vectors are distributed across the processors
+   */
+  bool isDistributed() const { return _is_distributed; }
+
 protected:
   /**
    * Register a new vector to fill up.
@@ -74,6 +79,8 @@ private:
 
   const bool _contains_complete_history;
 
+  const bool _is_distributed;
+
   std::map<std::string, VectorPostprocessorValue> _thread_local_vectors;
 };
 
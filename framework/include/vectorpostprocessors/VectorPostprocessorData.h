@@ -44,10 +44,13 @@ public:
    *
    * @param vpp_name The name of the VectorPostprocessor
    * @param vector_name The name of the vector
+   * @param contains_complete_history True if the vector will contain the complete history
+   * @param is_distributed True if the vector is distributed across the processors
    */
   VectorPostprocessorValue & declareVector(const std::string & vpp_name,
                                            const std::string & vector_name,
-                                           bool contains_complete_history);
+                                           bool contains_complete_history,
+                                           bool is_distributed = false);
 
   /**
    * Returns a true value if the VectorPostprocessor exists
@@ -83,6 +86,11 @@ public:
    */
   bool containsCompleteHistory(const std::string & name) const;
 
+  /**
+   * Returns a Boolean indicating whether the specified VPP vectors are distributed.
+   */
+  bool isDistributed(const std::string & name) const;
+
   /**
    * Get the map of vectors for a particular VectorPostprocessor
    * @param vpp_name The name of the VectorPostprocessor
@@ -119,6 +127,9 @@ private:
     /// Boolean indicating whether these vectors contain complete history (append mode)
     bool _contains_complete_history;
 
+    /// Boolean indicating whether these vectors are distributed across the processors
+    bool _is_distributed;
+
     /// Boolean indicating whether any old vectors have been requested.
     bool _needs_old;
   };
@@ -25,6 +25,12 @@ public:
   virtual void act() override;
 
 protected:
+  /// Add the AqueousEquilibriumNetworkMaterial and the Kernels that use it
+  void addNetworkObjects();
+
+  /// Add an AqueousEquilibriumRxnAux AuxKernel for each equilibrium species that is output
+  void addEquilibriumAuxKernels();
+
   /// Basis set of primary species
   const std::vector<NonlinearVariableName> _primary_species;
   /// Secondary species added as AuxVariables
@@ -59,6 +65,8 @@ protected:
   const std::vector<VariableName> _pressure_var;
   /// Gravity (default is (0, 0, 0))
   const RealVectorValue _gravity;
+  /// Whether to evaluate the whole network in a single AqueousEquilibriumNetworkMaterial
+  const bool _use_network_material;
 };
 
 #endif // ADDCOUPLEDEQSPECIESACTION_H
@@ -0,0 +1,69 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EQUILIBRIUMNETWORKCONVECTION_H
+#define EQUILIBRIUMNETWORKCONVECTION_H
+
+#include "Kernel.h"
+
+// Forward Declarations
+class EquilibriumNetworkConvection;
+
+template <>
+InputParameters validParams<EquilibriumNetworkConvection>();
+
+/**
+ * Convection of the primary species held in all equilibrium species of a
+ * reaction network, using the totals computed by AqueousEquilibriumNetworkMaterial.
+ * Replaces one CoupledConvectionReactionSub Kernel per equilibrium reaction
+ */
+class EquilibriumNetworkConvection : public Kernel
+{
+public:
+  EquilibriumNetworkConvection(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /**
+   * Jacobian entry wrt the primary species with index m
+   * @param m index of the primary species
+   * @return Jacobian entry
+   */
+  Real computeQpNetworkJacobian(unsigned int m);
+
+  /// Gradient of the total concentration in equilibrium species at the current qp
+  RealGradient gradTotal() const;
+
+private:
+  /// Index of the variable this kernel acts on in the list of primary species
+  unsigned int _index;
+  /// Map from variable number to index in the list of primary species
+  std::map<unsigned int, unsigned int> _primary_index;
+  /// Gradients of the primary species concentrations
+  std::vector<const VariableGradient *> _grad_vals;
+  /// Hydraulic conductivity
+  const MaterialProperty<Real> & _cond;
+  /// Gravity
+  const RealVectorValue _gravity;
+  /// Fluid density
+  const MaterialProperty<Real> & _density;
+  /// Pressure gradient
+  const VariableGradient & _grad_p;
+  /// Pressure variable number
+  const unsigned int _pvar;
+  /// Derivative of the totals wrt the primary species
+  const MaterialProperty<std::vector<std::vector<Real>>> & _dtotal;
+  /// Second derivatives of the totals contracted with the primary species gradients
+  const MaterialProperty<std::vector<RealGradient>> & _d2total_grad;
+};
+
+#endif // EQUILIBRIUMNETWORKCONVECTION_H
@@ -0,0 +1,58 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EQUILIBRIUMNETWORKDIFFUSION_H
+#define EQUILIBRIUMNETWORKDIFFUSION_H
+
+#include "Kernel.h"
+
+// Forward Declarations
+class EquilibriumNetworkDiffusion;
+
+template <>
+InputParameters validParams<EquilibriumNetworkDiffusion>();
+
+/**
+ * Diffusion of the primary species held in all equilibrium species of a
+ * reaction network, using the totals computed by AqueousEquilibriumNetworkMaterial.
+ * Replaces one CoupledDiffusionReactionSub Kernel per equilibrium reaction
+ */
+class EquilibriumNetworkDiffusion : public Kernel
+{
+public:
+  EquilibriumNetworkDiffusion(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /**
+   * Jacobian entry wrt the primary species with index m
+   * @param m index of the primary species
+   * @return Jacobian entry
+   */
+  Real computeQpNetworkJacobian(unsigned int m);
+
+private:
+  /// Index of the variable this kernel acts on in the list of primary species
+  unsigned int _index;
+  /// Map from variable number to index in the list of primary species
+  std::map<unsigned int, unsigned int> _primary_index;
+  /// Gradients of the primary species concentrations
+  std::vector<const VariableGradient *> _grad_vals;
+  /// Material property of dispersion-diffusion coefficient
+  const MaterialProperty<Real> & _diffusivity;
+  /// Derivative of the totals wrt the primary species
+  const MaterialProperty<std::vector<std::vector<Real>>> & _dtotal;
+  /// Second derivatives of the totals contracted with the primary species gradients
+  const MaterialProperty<std::vector<RealGradient>> & _d2total_grad;
+};
+
+#endif // EQUILIBRIUMNETWORKDIFFUSION_H
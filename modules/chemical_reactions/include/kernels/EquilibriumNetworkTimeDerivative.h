@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EQUILIBRIUMNETWORKTIMEDERIVATIVE_H
+#define EQUILIBRIUMNETWORKTIMEDERIVATIVE_H
+
+#include "TimeKernel.h"
+
+// Forward Declarations
+class EquilibriumNetworkTimeDerivative;
+
+template <>
+InputParameters validParams<EquilibriumNetworkTimeDerivative>();
+
+/**
+ * Time derivative of the primary species held in all equilibrium species of
+ * a reaction network, using the totals computed by AqueousEquilibriumNetworkMaterial.
+ * Replaces one CoupledBEEquilibriumSub Kernel per equilibrium reaction
+ */
+class EquilibriumNetworkTimeDerivative : public TimeKernel
+{
+public:
+  EquilibriumNetworkTimeDerivative(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+private:
+  /// Index of the variable this kernel acts on in the list of primary species
+  unsigned int _index;
+  /// Map from variable number to index in the list of primary species
+  std::map<unsigned int, unsigned int> _primary_index;
+  /// Porosity
+  const MaterialProperty<Real> & _porosity;
+  /// Total concentration of the primary species in equilibrium species
+  const MaterialProperty<std::vector<Real>> & _total;
+  /// Old total concentration of the primary species in equilibrium species
+  const MaterialProperty<std::vector<Real>> & _total_old;
+  /// Derivative of the totals wrt the primary species
+  const MaterialProperty<std::vector<std::vector<Real>>> & _dtotal;
+};
+
+#endif // EQUILIBRIUMNETWORKTIMEDERIVATIVE_H
@@ -0,0 +1,86 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef AQUEOUSEQUILIBRIUMNETWORKMATERIAL_H
+#define AQUEOUSEQUILIBRIUMNETWORKMATERIAL_H
+
+#include "Material.h"
+
+// Forward Declarations
+class AqueousEquilibriumNetworkMaterial;
+
+template <>
+InputParameters validParams<AqueousEquilibriumNetworkMaterial>();
+
+/**
+ * Evaluates a complete network of aqueous equilibrium reactions at each
+ * quadrature point. The network is described by its stoichiometric matrix S
+ * (one row per equilibrium species, one column per primary species) and the
+ * equilibrium constants, so that the concentration of equilibrium species j is
+ *
+ *   c_j = 10^log_k_j prod_i u_i^S_ji
+ *
+ * The total concentration of each primary species held in equilibrium species,
+ * T_i = sum_j S_ji c_j, and its first derivatives with respect to all primary
+ * species are computed together, so that each power of each primary species is
+ * evaluated once per quadrature point rather than once per kernel. When computing
+ * the Jacobian, the derivative of grad(T_i) with respect to each primary species
+ * (excluding the term in the gradient of the shape function) is also computed.
+ */
+class AqueousEquilibriumNetworkMaterial : public Material
+{
+public:
+  AqueousEquilibriumNetworkMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+  /// Number of primary species
+  const unsigned int _num_primary;
+  /// Number of equilibrium reactions (equilibrium species)
+  unsigned int _num_reactions;
+  /// Primary species concentrations
+  std::vector<const VariableValue *> _vals;
+  /// Gradients of the primary species concentrations
+  std::vector<const VariableGradient *> _grad_vals;
+  /// Equilibrium constants of the reactions
+  const std::vector<Real> _log_k;
+  /// 10^log_k for each reaction
+  std::vector<Real> _k;
+  /// Indices of the primary species taking part in each reaction
+  std::vector<std::vector<unsigned int>> _participants;
+  /// Stoichiometric coefficients of the primary species taking part in each reaction
+  std::vector<std::vector<Real>> _participant_stos;
+
+  /// Concentration of each equilibrium species
+  MaterialProperty<std::vector<Real>> & _secondary_conc;
+  /// Total concentration of each primary species held in equilibrium species
+  MaterialProperty<std::vector<Real>> & _total;
+  /// Derivative of the totals wrt the primary species: _dtotal[i][k] = dT_i/du_k
+  MaterialProperty<std::vector<std::vector<Real>>> & _dtotal;
+  /// Second derivatives of the totals contracted with the primary species gradients (only
+  /// computed for the Jacobian): _d2total_grad[i * n + m] = sum_k d^2T_i/du_k du_m grad(u_k)
+  MaterialProperty<std::vector<RealGradient>> & _d2total_grad;
+
+private:
+  /**
+   * Evaluate the equilibrium species concentrations and the totals at the current qp
+   * @param[out] total total concentration of each primary species in equilibrium species
+   * @param with_derivatives true to also compute the first derivatives
+   * @param with_second_derivatives true to also compute the second derivatives
+   */
+  void
+  computeNetwork(std::vector<Real> & total, bool with_derivatives, bool with_second_derivatives);
+
+  /// Powers of the participating primary species: u^S, S u^(S-1) and S (S-1) u^(S-2)
+  std::vector<Real> _pow, _dpow, _d2pow;
+};
+
+#endif // AQUEOUSEQUILIBRIUMNETWORKMATERIAL_H
@@ -14,6 +14,8 @@
 #include "NodeFaceConstraint.h"
 #include "ContactMaster.h"
 
+#include "libmesh/stored_range.h"
+
 // Forward Declarations
 class MechanicalContactConstraint;
 class ContactLineSearchBase;
@@ -31,6 +33,7 @@ public:
   MechanicalContactConstraint(const InputParameters & parameters);
 
   virtual void timestepSetup() override;
+  virtual void residualSetup() override;
   virtual void jacobianSetup() override;
   virtual void residualEnd() override;
 
@@ -40,6 +43,14 @@ public:
 
   virtual void updateContactStatefulData(bool beginning_of_step = false);
 
+  /**
+   * Determine the set of slave nodes in contact for the current nonlinear iteration using a
+   * semismooth Newton complementarity criterion. This is called before the first nonlinear
+   * residual of each iteration, and the set is held fixed for the remaining residual and
+   * Jacobian evaluations of that iteration.
+   */
+  void updateActiveSet();
+
   virtual Real computeQpSlaveValue() override;
 
   virtual Real computeQpResidual(Moose::ConstraintType type) override;
@@ -138,6 +149,23 @@ protected:
 
   const bool _print_contact_nodes;
   static Threads::spin_mutex _contact_set_mutex;
+
+  /// Whether the contact set is determined once per nonlinear iteration
+  const bool _active_set_solve;
+  /// Scaling of the penalty used as the complementarity constant in the active set criterion
+  const Real _active_set_c;
+  /// Whether the active set is updated before the next nonlinear residual evaluation
+  bool _update_active_set;
+
+  /**
+   * Evaluate the complementarity criterion for a single slave node
+   * @return true if the node belongs to the active set
+   */
+  bool activeSetCriterion(PenetrationInfo & pinfo);
+
+  typedef StoredRange<std::vector<PenetrationInfo *>::iterator, PenetrationInfo *>
+      PenetrationInfoRange;
+  class ActiveSetThread;
 };
 
 #endif
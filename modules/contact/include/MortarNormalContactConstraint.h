@@ -0,0 +1,68 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef MORTARNORMALCONTACTCONSTRAINT_H
+#define MORTARNORMALCONTACTCONSTRAINT_H
+
+#include "MortarConstraint.h"
+
+// Forward Declarations
+class MortarNormalContactConstraint;
+
+template <>
+InputParameters validParams<MortarNormalContactConstraint>();
+
+/**
+ * Enforces frictionless normal contact across a mortar interface. The Lagrange multiplier is the
+ * contact pressure, and the Karush-Kuhn-Tucker conditions (gap >= 0, pressure >= 0,
+ * gap * pressure = 0) are enforced weakly through the nonlinear complementarity function
+ * min(pressure, c * gap), which is solved with a semismooth Newton method.
+ *
+ * All displacement components are coupled through the normal gap
+ * (x_master - x_slave) . n + n . (u_master - u_slave), so the interface may have any orientation.
+ * The master_variable must be one of the displacements; the same displacement variables are used
+ * on both sides of the interface.
+ */
+class MortarNormalContactConstraint : public MortarConstraint
+{
+public:
+  MortarNormalContactConstraint(const InputParameters & parameters);
+
+  virtual void reinit() override;
+  virtual void reinitSide(Moose::ConstraintType res_type) override;
+
+  virtual void computeResidualSide(Moose::ConstraintType side) override;
+  virtual void computeJacobianSide(Moose::ConstraintType side) override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpResidualSide(Moose::ConstraintType res_type) override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpJacobianSide(Moose::ConstraintJacobianType jac_type) override;
+
+  /// Whether the gap branch of the complementarity function is active at the current qp
+  bool inContact() const { return _c * _gap[_qp] <= _lambda[_qp]; }
+
+  /// The displacement variables, one per mesh dimension
+  std::vector<MooseVariable *> _disp_vars;
+
+  /// The displacement component whose side contributions are being computed
+  unsigned int _component;
+
+  /// Scaling of the gap in the complementarity function
+  const Real _c;
+
+  /// The normal gap at each quadrature point of the interface element
+  std::vector<Real> _gap;
+
+  /// The slave surface normal at each qp, zero where the point could not be projected
+  std::vector<RealVectorValue> _normals;
+};
+
+#endif // MORTARNORMALCONTACTCONSTRAINT_H
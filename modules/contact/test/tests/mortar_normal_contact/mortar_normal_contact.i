@@ -0,0 +1,127 @@
+# Two blocks stacked in y, meeting along a mortar interface at y = 0.5. The bottom of the lower
+# block is held fixed while the top of the upper block is pushed down, so the upper block comes
+# into contact with the lower one. Each displacement component is modeled by a diffusion equation,
+# for which the exact solution in contact is disp_x = 0 and disp_y = -0.1 * y with a contact
+# pressure of 0.1.
+# When the top is pulled up instead (top value 0.1), the blocks separate: the lower block stays
+# at rest, the upper block moves up by 0.1 and the contact pressure vanishes.
+
+[Mesh]
+  file = 2blk-conf.e
+
+  [./MortarInterfaces]
+    [./middle]
+      master = 100
+      slave = 101
+      subdomain = 1000
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./exact_sln]
+    type = ParsedFunction
+    value = '-0.1 * y'
+  [../]
+[]
+
+[Variables]
+  [./disp_x]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+  [./disp_y]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+
+  [./contact_pressure]
+    order = FIRST
+    family = LAGRANGE
+    block = middle
+  [../]
+[]
+
+[Kernels]
+  [./diff_x]
+    type = Diffusion
+    variable = disp_x
+  [../]
+  [./diff_y]
+    type = Diffusion
+    variable = disp_y
+  [../]
+[]
+
+[Constraints]
+  [./contact]
+    type = MortarNormalContactConstraint
+    variable = contact_pressure
+    interface = middle
+    master_variable = disp_y
+    displacements = 'disp_x disp_y'
+  [../]
+[]
+
+[BCs]
+  [./bottom_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 1
+    value = 0
+  [../]
+  [./top_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 3
+    value = 0
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0
+  [../]
+  [./top]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 3
+    value = -0.1
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_error]
+    type = ElementL2Error
+    variable = disp_y
+    function = exact_sln
+    block = '1 2'
+  [../]
+  [./contact_force]
+    type = ElementIntegralVariablePostprocessor
+    variable = contact_pressure
+    block = middle
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+    solve_type = 'NEWTON'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  nl_rel_tol = 1e-11
+  l_tol = 1e-10
+  petsc_options_iname = '-pc_type -pc_factor_shift_type'
+  petsc_options_value = 'lu       NONZERO'
+[]
+
+[Outputs]
+  csv = true
+[]
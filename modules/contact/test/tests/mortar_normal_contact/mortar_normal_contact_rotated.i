@@ -0,0 +1,143 @@
+# The contact problem of mortar_normal_contact.i rotated counterclockwise by 30 degrees, so that
+# the mortar interface is not aligned with the coordinate axes and both displacement components
+# enter the normal gap. With eta = -x / 2 + sqrt(3) / 2 * y the coordinate across the interface,
+# the exact solution is the rotated displacement -0.1 * eta in the direction (-1 / 2, sqrt(3) / 2),
+# with the same contact pressure of 0.1 as in the aligned problem.
+
+[Mesh]
+  file = 2blk-conf.e
+
+  [./MortarInterfaces]
+    [./middle]
+      master = 100
+      slave = 101
+      subdomain = 1000
+    [../]
+  [../]
+[]
+
+[MeshModifiers]
+  [./rotate]
+    type = Transform
+    transform = ROTATE
+    vector_value = '30 0 0'
+  [../]
+[]
+
+[Functions]
+  [./exact_sln_x]
+    type = ParsedFunction
+    value = '0.05 * (sqrt(3) / 2 * y - x / 2)'
+  [../]
+  [./exact_sln_y]
+    type = ParsedFunction
+    value = '-0.05 * sqrt(3) * (sqrt(3) / 2 * y - x / 2)'
+  [../]
+[]
+
+[Variables]
+  [./disp_x]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+  [./disp_y]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+
+  [./contact_pressure]
+    order = FIRST
+    family = LAGRANGE
+    block = middle
+  [../]
+[]
+
+[Kernels]
+  [./diff_x]
+    type = Diffusion
+    variable = disp_x
+  [../]
+  [./diff_y]
+    type = Diffusion
+    variable = disp_y
+  [../]
+[]
+
+[Constraints]
+  [./contact]
+    type = MortarNormalContactConstraint
+    variable = contact_pressure
+    interface = middle
+    master_variable = disp_y
+    displacements = 'disp_x disp_y'
+  [../]
+[]
+
+[BCs]
+  [./bottom_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 1
+    value = 0
+  [../]
+  [./bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0
+  [../]
+  [./top_x]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 3
+    function = exact_sln_x
+  [../]
+  [./top_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 3
+    function = exact_sln_y
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_error_x]
+    type = ElementL2Error
+    variable = disp_x
+    function = exact_sln_x
+    block = '1 2'
+  [../]
+  [./l2_error_y]
+    type = ElementL2Error
+    variable = disp_y
+    function = exact_sln_y
+    block = '1 2'
+  [../]
+  [./contact_force]
+    type = ElementIntegralVariablePostprocessor
+    variable = contact_pressure
+    block = middle
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+    solve_type = 'NEWTON'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  nl_rel_tol = 1e-11
+  l_tol = 1e-10
+  petsc_options_iname = '-pc_type -pc_factor_mat_solver_package'
+  petsc_options_value = 'lu       mumps'
+[]
+
+[Outputs]
+  csv = true
+[]
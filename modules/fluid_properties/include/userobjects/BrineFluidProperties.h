@@ -123,6 +123,16 @@ public:
 
   virtual Real k(Real pressure, Real temperature, Real xnacl) const override;
 
+  /**
+   * The density and enthalpy at each finite difference stencil point are evaluated
+   * once and shared with the internal energy
+   */
+  virtual void batch_dpTx(const std::vector<Real> & pressure,
+                          const std::vector<Real> & temperature,
+                          const std::vector<Real> & xnacl,
+                          unsigned int properties,
+                          FluidPropertiesBatch & batch) const override;
+
   /**
    * Brine vapour pressure
    * From Haas, Physical properties of the coexisting phases and thermochemical
@@ -261,6 +261,15 @@ public:
   virtual void
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  /**
+   * The density (found iteratively) and the derivatives of the Helmholtz free energy
+   * are computed once per point and shared by all requested properties
+   */
+  virtual void batch_dpT(const std::vector<Real> & pressure,
+                         const std::vector<Real> & temperature,
+                         unsigned int properties,
+                         FluidPropertiesBatch & batch) const override;
+
 protected:
   /// Molar mass of CO2 (kg/mol)
   const Real _Mco2 = 44.0098e-3;
@@ -90,6 +90,12 @@ public:
   virtual void
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  /// Enthalpy and internal energy share a single evaluation of the polynomial in temperature
+  virtual void batch_dpT(const std::vector<Real> & pressure,
+                         const std::vector<Real> & temperature,
+                         unsigned int properties,
+                         FluidPropertiesBatch & batch) const override;
+
   virtual Real henryConstant(Real temperature) const override;
 
   virtual void henryConstant_dT(Real temperature, Real & Kh, Real & dKh_dT) const override;
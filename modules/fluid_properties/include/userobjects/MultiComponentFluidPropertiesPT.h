@@ -195,6 +195,23 @@ public:
    */
   virtual Real k(Real pressure, Real temperature, Real xmass) const = 0;
 
+  /**
+   * Density, internal energy, enthalpy and/or viscosity and their derivatives wrt
+   * pressure, temperature and mass fraction at a number of points in a single call.
+   * The default implementation calls the individual *_dpTx methods at each point.
+   * Derived classes should override this to share work between the properties.
+   * @param pressure fluid pressure at each point (Pa)
+   * @param temperature fluid temperature at each point (K)
+   * @param xmass mass fraction at each point (-)
+   * @param properties combination of FluidPropertiesBatch::Property flags
+   * @param[out] batch the requested properties and their derivatives at each point
+   */
+  virtual void batch_dpTx(const std::vector<Real> & pressure,
+                          const std::vector<Real> & temperature,
+                          const std::vector<Real> & xmass,
+                          unsigned int properties,
+                          FluidPropertiesBatch & batch) const;
+
   /**
    * Get UserObject for specified component
    * @param component fluid component
@@ -11,6 +11,7 @@
 #define SINGLEPHASEFLUIDPROPERTIESPT_H
 
 #include "FluidProperties.h"
+#include "FluidPropertiesBatch.h"
 
 class SinglePhaseFluidPropertiesPT;
 
@@ -284,6 +285,21 @@ public:
   virtual void
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const = 0;
 
+  /**
+   * Density, internal energy, enthalpy and viscosity (as requested) and their
+   * derivatives wrt pressure and temperature at an array of points. Derived
+   * classes override this to share intermediate quantities between the properties
+   * (and points) instead of evaluating each property separately.
+   * @param pressure fluid pressure at each point (Pa)
+   * @param temperature fluid temperature at each point (K)
+   * @param properties the properties to compute (combination of FluidPropertiesBatch::Property)
+   * @param[out] batch the requested properties and their derivatives at each point
+   */
+  virtual void batch_dpT(const std::vector<Real> & pressure,
+                         const std::vector<Real> & temperature,
+                         unsigned int properties,
+                         FluidPropertiesBatch & batch) const;
+
   /**
    * Isobaric thermal expansion coefficient, defined as
    * 1/v (dv/dT)_p, where v is the volume, and the derivative wrt temperature is
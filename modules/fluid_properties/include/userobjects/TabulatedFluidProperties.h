@@ -139,6 +139,15 @@ public:
                           Real & dmu_dp,
                           Real & dmu_dT) const override;
 
+  /**
+   * Interpolated properties are sampled from the tables, while the remaining
+   * properties are computed in a single batched call to the FluidProperties UserObject
+   */
+  virtual void batch_dpT(const std::vector<Real> & pressure,
+                         const std::vector<Real> & temperature,
+                         unsigned int properties,
+                         FluidPropertiesBatch & batch) const override;
+
   virtual Real cp(Real pressure, Real temperature) const override;
 
   virtual Real cv(Real pressure, Real temperature) const override;
@@ -213,6 +222,8 @@ protected:
   unsigned int _num_T;
   /// Number of pressure points in the tabulated data
   unsigned int _num_p;
+  /// Whether generated pressure points are logarithmically spaced
+  const bool _log_pressure_spacing;
 
   /// SinglePhaseFluidPropertiesPT UserObject
   const SinglePhaseFluidPropertiesPT & _fp;
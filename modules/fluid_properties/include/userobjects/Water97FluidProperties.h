@@ -121,6 +121,16 @@ public:
   virtual void
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  /**
+   * Region detection, the Gibbs (or Helmholtz in region 3) free energy derivatives
+   * and the region 3 density are computed once per point and shared by all
+   * requested properties
+   */
+  virtual void batch_dpT(const std::vector<Real> & pressure,
+                         const std::vector<Real> & temperature,
+                         unsigned int properties,
+                         FluidPropertiesBatch & batch) const override;
+
   virtual Real vaporPressure(Real temperature) const override;
 
   virtual void vaporPressure_dT(Real temperature, Real & psat, Real & dpsat_dT) const override;
@@ -480,6 +490,28 @@ protected:
    */
   Real d2gamma5_dpitau(Real pi, Real tau) const;
 
+  /**
+   * First and second derivatives of the Gibbs free energy in regions 1, 2 or 5,
+   * computed together in a single pass over the terms of the formulation
+   *
+   * @param region region (1, 2 or 5)
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] dg_dpi derivative of Gibbs free energy wrt pi
+   * @param[out] d2g_dpi2 second derivative of Gibbs free energy wrt pi
+   * @param[out] dg_dtau derivative of Gibbs free energy wrt tau
+   * @param[out] d2g_dtau2 second derivative of Gibbs free energy wrt tau
+   * @param[out] d2g_dpitau second derivative of Gibbs free energy wrt pi and tau
+   */
+  void gibbsDerivatives(unsigned int region,
+                        Real pi,
+                        Real tau,
+                        Real & dg_dpi,
+                        Real & d2g_dpi2,
+                        Real & dg_dtau,
+                        Real & d2g_dtau2,
+                        Real & d2g_dpitau) const;
+
   /// Enum of subregion ids for region 3
   enum subregionEnum
   {
@@ -0,0 +1,81 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef FLUIDPROPERTIESBATCH_H
+#define FLUIDPROPERTIESBATCH_H
+
+#include "Moose.h"
+
+/**
+ * Storage for fluid properties and their derivatives evaluated at an array of
+ * (pressure, temperature) points in a single call, see
+ * SinglePhaseFluidPropertiesPT::batch_dpT() and MultiComponentFluidPropertiesPT::batch_dpTx().
+ *
+ * Each property is stored as a set of contiguous arrays indexed by point.  Only the
+ * arrays of the requested properties are sized.  The object is intended to be kept
+ * and reused by the caller, so that repeated evaluations do not allocate memory once
+ * the arrays have reached their final size.
+ */
+struct FluidPropertiesBatch
+{
+  /// Flags selecting the properties to compute (may be combined using |)
+  enum Property : unsigned int
+  {
+    DENSITY = 1u << 0,
+    INTERNAL_ENERGY = 1u << 1,
+    ENTHALPY = 1u << 2,
+    VISCOSITY = 1u << 3,
+    ALL = DENSITY | INTERNAL_ENERGY | ENTHALPY | VISCOSITY
+  };
+
+  /**
+   * Sizes the arrays of the requested properties
+   * @param n number of points
+   * @param properties combination of Property flags
+   * @param mass_fraction_derivatives whether the derivatives wrt mass fraction are required
+   */
+  void resize(std::size_t n, unsigned int properties, bool mass_fraction_derivatives = false)
+  {
+    const std::size_t nx = mass_fraction_derivatives ? n : 0;
+
+    if (properties & DENSITY)
+      resizeProperty(n, nx, rho, drho_dp, drho_dT, drho_dx);
+    if (properties & INTERNAL_ENERGY)
+      resizeProperty(n, nx, e, de_dp, de_dT, de_dx);
+    if (properties & ENTHALPY)
+      resizeProperty(n, nx, h, dh_dp, dh_dT, dh_dx);
+    if (properties & VISCOSITY)
+      resizeProperty(n, nx, mu, dmu_dp, dmu_dT, dmu_dx);
+  }
+
+  /// Density (kg/m^3) and its derivatives wrt pressure, temperature and mass fraction
+  std::vector<Real> rho, drho_dp, drho_dT, drho_dx;
+  /// Internal energy (J/kg) and its derivatives wrt pressure, temperature and mass fraction
+  std::vector<Real> e, de_dp, de_dT, de_dx;
+  /// Enthalpy (J/kg) and its derivatives wrt pressure, temperature and mass fraction
+  std::vector<Real> h, dh_dp, dh_dT, dh_dx;
+  /// Viscosity (Pa.s) and its derivatives wrt pressure, temperature and mass fraction
+  std::vector<Real> mu, dmu_dp, dmu_dT, dmu_dx;
+
+private:
+  static void resizeProperty(std::size_t n,
+                             std::size_t nx,
+                             std::vector<Real> & value,
+                             std::vector<Real> & d_dp,
+                             std::vector<Real> & d_dT,
+                             std::vector<Real> & d_dx)
+  {
+    value.resize(n);
+    d_dp.resize(n);
+    d_dT.resize(n);
+    d_dx.resize(nx);
+  }
+};
+
+#endif // FLUIDPROPERTIESBATCH_H
@@ -28,6 +28,7 @@ public:
   GapHeatTransfer(const InputParameters & parameters);
 
   virtual void initialSetup() override;
+  virtual void computeResidual() override;
 
 protected:
   virtual Real computeQpResidual() override;
@@ -45,6 +46,9 @@ protected:
 
   NumericVector<Number> * _slave_flux;
 
+  /// Slave flux contributions of the current element, added to _slave_flux once per element
+  DenseVector<Number> _local_slave_flux;
+
   const MaterialProperty<Real> & _gap_conductance;
   const MaterialProperty<Real> & _gap_conductance_dT;
 
@@ -53,6 +53,9 @@ public:
                               Real & radius);
 
   virtual void initialSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+  virtual void meshChanged() override;
 
 protected:
   virtual void computeQpProperties() override;
@@ -70,6 +73,33 @@ protected:
 
   virtual void computeGapValues();
 
+  /// Gap pairing data at a quadrature point, valid until the penetration locator is updated
+  struct GapPairing
+  {
+    /// Whether penetration information was found for this quadrature point
+    bool has_info;
+    /// Distance across the gap
+    Real distance;
+    /// Dof indices of the temperature variable on the paired side
+    std::vector<dof_id_type> dof_indices;
+    /// Shape function values on the paired side at the paired point
+    std::vector<Real> phi;
+  };
+
+  /**
+   * Returns the gap pairing data for all quadrature points on the current element side,
+   * recomputing it only if the penetration locator has been updated since it was stored
+   */
+  const std::vector<GapPairing> & sidePairing();
+
+  /**
+   * Registers the temperature dofs of every element that the quadrature points may be paired with
+   * (the elements connected to the master nodes of their geometric search patches), so that they
+   * are available through SystemBase::remoteSolution() even if the paired element is owned by
+   * another processor.  Only does work after the patches have been rebuilt.
+   */
+  void requestGapDofs();
+
   const std::string _appended_property_name;
 
   const VariableValue & _temp;
@@ -104,7 +134,13 @@ protected:
 
   MooseVariable * _temp_var;
   PenetrationLocator * _penetration_locator;
-  const NumericVector<Number> ** _serialized_solution;
+
+  /// Stored gap pairing data for each element side
+  std::map<std::pair<dof_id_type, unsigned int>, std::vector<GapPairing>> _side_pairing;
+  /// Penetration locator update count at which _side_pairing was stored
+  unsigned int _side_pairing_update_count;
+  /// Patch update count of the nearest node locator at which the paired dofs were last requested
+  unsigned int _requested_dofs_patch_count;
   DofMap * _dof_map;
   const bool _warnings;
 
@@ -0,0 +1,86 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef INSCHORINTRANSIENT_H
+#define INSCHORINTRANSIENT_H
+
+#include "Transient.h"
+
+// System includes
+#include <chrono>
+
+// Forward Declarations
+class INSChorinTransient;
+
+template <>
+InputParameters validParams<INSChorinTransient>();
+
+/**
+ * Transient executioner for the split-operator (Chorin) formulation of the
+ * incompressible Navier-Stokes equations provided by the INSChorinPredictor,
+ * INSChorinCorrector and INSChorinPressurePoisson kernels.
+ *
+ * When the predictor is explicit, the residual of the coupled predictor /
+ * pressure-Poisson / corrector system is linear in the unknowns and its
+ * Jacobian depends only on the mesh and the timestep size.  This executioner
+ * then assembles and factors the system matrix once and reuses it (and the
+ * preconditioner built from it) for every subsequent timestep, only
+ * recomputing it when the timestep size or the number of degrees of freedom
+ * changes.
+ */
+class INSChorinTransient : public Transient
+{
+public:
+  INSChorinTransient(const InputParameters & parameters);
+
+  virtual void init() override;
+
+  virtual void preSolve() override;
+  virtual void postSolve() override;
+
+protected:
+  /**
+   * Whether the system matrix assembled during a previous timestep can be
+   * used for the upcoming solve.
+   */
+  bool canReuseJacobian() const;
+
+  /**
+   * Tell the nonlinear solver whether to assemble a new Jacobian and
+   * preconditioner at the start of the next solve, or to keep the current ones.
+   * @param recompute true if a new Jacobian must be assembled
+   */
+  void lagJacobian(bool recompute);
+
+  /// Whether to reuse the system matrix between timesteps
+  const bool _reuse_jacobian;
+
+  /// Whether to print the wall time and residual evaluations of each step
+  const bool _print_step_timing;
+
+  /// Timestep size used when the system matrix was last assembled
+  Real _jacobian_dt;
+
+  /// Number of degrees of freedom when the system matrix was last assembled
+  dof_id_type _jacobian_n_dofs;
+
+  /// Whether a system matrix has been assembled yet
+  bool _have_jacobian;
+
+  /// Number of residual evaluations at the start of the current solve
+  unsigned int _n_residual_evaluations_start;
+
+  /// Wall clock time at the start of the current solve
+  std::chrono::time_point<std::chrono::steady_clock> _solve_start;
+
+  /// Number of timesteps for which the system matrix was reused
+  unsigned int _n_reused;
+};
+
+#endif // INSCHORINTRANSIENT_H
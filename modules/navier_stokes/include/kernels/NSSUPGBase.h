@@ -29,6 +29,23 @@ public:
   NSSUPGBase(const InputParameters & parameters);
 
 protected:
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
+  /**
+   * Computes the SUPG Jacobian matrix at every quadrature point of the current
+   * element for the Moose variable var, storing it in _supg_jacobian.  Derived
+   * classes call this from precalculateJacobian() with their on-diagonal variable.
+   */
+  void precalculateSUPGJacobian(unsigned int var);
+
+  /**
+   * The matrix M such that the SUPG Jacobian contribution with respect to the
+   * canonical NS variable m is grad(phi_i) * (M * grad(phi_j)) at the current _qp.
+   * It depends only on the quadrature point, so is computed once per element
+   * rather than for every pair of shape functions.
+   */
+  virtual RealTensorValue computeQpSUPGJacobianMatrix(unsigned int m);
+
   // Material properties
   const MaterialProperty<RealTensorValue> & _viscous_stress_tensor;
   const MaterialProperty<Real> & _dynamic_viscosity;
@@ -70,6 +87,9 @@ protected:
 
   // Enthalpy aux variable
   const VariableValue & _enthalpy;
+
+  // SUPG Jacobian matrices at each qp, for the variable currently being differentiated
+  std::vector<RealTensorValue> _supg_jacobian;
 };
 
 #endif // NSSUPGBASE_H
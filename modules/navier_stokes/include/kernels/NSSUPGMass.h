@@ -32,6 +32,9 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  virtual void precalculateJacobian() override;
+  virtual RealTensorValue computeQpSUPGJacobianMatrix(unsigned int m) override;
+
 private:
   // Single function for computing on and off-diagonal Jacobian
   // entries in a single function.  The input index is in Moose
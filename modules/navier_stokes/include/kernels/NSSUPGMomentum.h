@@ -32,6 +32,9 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  virtual void precalculateJacobian() override;
+  virtual RealTensorValue computeQpSUPGJacobianMatrix(unsigned int m) override;
+
   // This kernel is to be used for the x, y, and z momentum equations.
   // The _component parameter tells you which equation you are currently
   // solving.
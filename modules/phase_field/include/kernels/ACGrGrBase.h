@@ -28,13 +28,30 @@ class ACGrGrBase : public ACBulk<Real>
 public:
   ACGrGrBase(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(MooseVariableFEBase & jvar) override;
+  using ACBulk<Real>::computeOffDiagJacobian;
+
 protected:
+  /// Rebuilds the list of coupled order parameters that are active on the current element
+  void updateActiveOps();
+
+  /// Checks whether the order parameter exceeds the activity threshold at any quadrature point
+  bool isActive(const VariableValue & op) const;
+
   const unsigned int _op_num;
 
   std::vector<const VariableValue *> _vals;
   std::vector<unsigned int> _vals_var;
 
   const MaterialProperty<Real> & _mu;
+
+  /// Order parameters not exceeding this magnitude anywhere on an element are skipped
+  const Real _active_op_threshold;
+
+  /// Indices into _vals of the order parameters active on the current element
+  std::vector<unsigned int> _active_ops;
 };
 
 #endif // ACGRGRBASE_H
@@ -28,6 +28,9 @@ class MultiBarrierFunctionMaterial : public DerivativeMaterialInterface<Material
 public:
   MultiBarrierFunctionMaterial(const InputParameters & parameters);
 
+  /// Skips the derivative properties that no other object requests
+  virtual void initialSetup();
+
 protected:
   virtual void computeQpProperties();
 
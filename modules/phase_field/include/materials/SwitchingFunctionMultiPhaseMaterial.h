@@ -31,6 +31,9 @@ class SwitchingFunctionMultiPhaseMaterial : public DerivativeMaterialInterface<M
 public:
   SwitchingFunctionMultiPhaseMaterial(const InputParameters & parameters);
 
+  /// Skips the derivative properties that no other object requests
+  virtual void initialSetup();
+
 protected:
   virtual void computeQpProperties();
 
@@ -42,6 +42,7 @@ public:
 
   virtual void readFile();
 
+  virtual void initialSetup();
   virtual void initialize() {}
   virtual void execute() {}
   virtual void finalize() {}
@@ -107,11 +108,19 @@ public:
   MooseSharedPointer<EBSDAvgDataFunctor>
   getAvgDataAccessFunctor(const MooseEnum & field_name) const;
 
+  /// Weight of a (global) grain at a node
+  typedef std::pair<unsigned int, Real> GrainWeight;
+
   /**
-   * Returns a map consisting of the node index followd by
-   * a vector of all grain weights for that node. Needed by ReconVarIC
+   * Get the nonzero grain weights of a node of the local or ghosted elements. Needed by
+   * PolycrystalEBSD
+   * @param node_id id of the node
+   * @param[out] begin, end range of the weights of the node, sorted by (global) grain ID
+   * @return false if the node is not attached to the local or ghosted elements
    */
-  const std::map<dof_id_type, std::vector<Real>> & getNodeToGrainWeightMap() const;
+  bool getNodeGrainWeights(dof_id_type node_id,
+                           const GrainWeight *& begin,
+                           const GrainWeight *& end) const;
 
   /**
    * Returns a map consisting of the node index followd by
@@ -138,6 +147,9 @@ protected:
   /// number of additional custom data columns
   unsigned int _custom_columns;
 
+  /// Only store the data points in the bounding box of the local and ghosted elements
+  const bool _local_subvolume;
+
   /// Logically three-dimensional data indexed by geometric points in a 1D vector
   std::vector<EBSDPointData> _data;
 
@@ -153,8 +165,13 @@ protected:
   /// global ID for given phases and grains
   std::vector<std::vector<unsigned int>> _global_id;
 
-  /// Map of grain weights per node
-  std::map<dof_id_type, std::vector<Real>> _node_to_grain_weight_map;
+  ///@{ Nonzero grain weights per node in compressed sparse row format: the weights of the node
+  /// _grain_weight_nodes[i] are _grain_weights[_grain_weight_offsets[i]] up to
+  /// _grain_weights[_grain_weight_offsets[i + 1]]
+  std::vector<dof_id_type> _grain_weight_nodes;
+  std::vector<std::size_t> _grain_weight_offsets;
+  std::vector<GrainWeight> _grain_weights;
+  ///@}
 
   /// Map of phase weights per node
   std::map<dof_id_type, std::vector<Real>> _node_to_phase_weight_map;
@@ -177,7 +194,16 @@ protected:
   /// Maximum grid extent
   Real _maxx, _maxy, _maxz;
 
-  /// Computes a global index in the _data array given an input *centroid* point
+  /// First grid index of the stored data in the x, y and z directions
+  unsigned _sub_x0, _sub_y0, _sub_z0;
+
+  /// The number of stored values in the x, y and z directions
+  unsigned _sub_nx, _sub_ny, _sub_nz;
+
+  /// Restrict the stored grid indices to the bounding box of the semilocal elements
+  void computeLocalSubvolume();
+
+  /// Computes an index in the _data array given an input *centroid* point
   unsigned indexFromPoint(const Point & p) const;
 
   /// Transfer the index into the _avg_data array from given index
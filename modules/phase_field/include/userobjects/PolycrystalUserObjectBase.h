@@ -12,7 +12,7 @@
 
 #include "FeatureFloodCount.h"
 
-#include "libmesh/dense_matrix.h"
+#include <unordered_map>
 
 // Forward Declarations
 class PolycrystalUserObjectBase;
@@ -110,7 +110,13 @@ protected:
                                              unsigned int & new_id) override;
 
   /**
-   * Builds a dense adjacency matrix based on the discovery of grain neighbors and halos
+   * Looks up the grains on every local entity using all available threads so that the serial
+   * flood doesn't have to.
+   */
+  void precomputeEntityGrains();
+
+  /**
+   * Builds the sparse grain adjacency graph based on the discovery of grain neighbors and halos
    * surrounding each grain.
    */
   void buildGrainAdjacencyMatrix();
@@ -138,8 +144,11 @@ protected:
   /*************************************************
    *************** Data Structures *****************
    ************************************************/
-  /// The dense adjacency matrix
-  std::unique_ptr<DenseMatrix<Real>> _adjacency_matrix;
+  /// The sorted list of neighboring grains for each grain (sparse adjacency matrix)
+  std::vector<std::vector<unsigned int>> _grain_neighbors;
+
+  /// The grains on each local entity, precomputed before flooding
+  std::unordered_map<dof_id_type, std::vector<unsigned int>> _entity_to_grains;
 
   /// mesh dimension
   const unsigned int _dim;
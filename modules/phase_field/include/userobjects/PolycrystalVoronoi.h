@@ -11,6 +11,7 @@
 #define POLYCRYSTALVORONOI_H
 
 #include "PolycrystalUserObjectBase.h"
+#include "KDTree.h"
 
 // Forward Declarations
 class PolycrystalVoronoi;
@@ -31,6 +32,12 @@ public:
   virtual unsigned int getNumGrains() const override { return _grain_num; }
 
 protected:
+  /**
+   * Builds the spatial search tree over the grain centers (and their periodic images). Must be
+   * called whenever _centerpoints is (re)computed.
+   */
+  void buildGrainCenterSearchTree();
+
   /// The number of grains to create
   const unsigned int _grain_num;
 
@@ -43,6 +50,15 @@ protected:
   Point _range;
 
   std::vector<Point> _centerpoints;
+
+  /// The grain centers along with their periodic images, used to build the search tree
+  std::vector<Point> _center_images;
+
+  /// The grain represented by each entry in _center_images
+  std::vector<unsigned int> _center_image_to_grain;
+
+  /// Spatial search tree used to look up the grain owning a point
+  std::unique_ptr<KDTree> _kd_tree;
 };
 
 #endif // POLYCRYSTALVORONOI_H
@@ -36,6 +36,7 @@ public:
 protected:
   virtual void computeQpProperties() override;
   virtual void thermophysicalProperties() override;
+  virtual void flashInputs(std::vector<Real> & inputs) const override;
 
   /// Salt mass fraction (kg/kg)
   const VariableValue & _xnacl;
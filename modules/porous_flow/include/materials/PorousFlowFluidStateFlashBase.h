@@ -47,6 +47,11 @@ InputParameters validParams<PorousFlowFluidStateFlashBase>();
  * A compositional flash calculation using the Rachford-Rice equation is solved
  * to determine vapor fraction (gas saturation), and subsequently the composition
  * of each phase.
+ *
+ * If flash_cache = true, the inputs and results of the flash calculation are stored
+ * at each node (or element quadpoint), and reused while the inputs are unchanged
+ * (to within flash_cache_tolerance). The stored equilibrium solution is also used as
+ * the initial guess for any iterative equilibrium calculation.
  */
 class PorousFlowFluidStateFlashBase : public PorousFlowVariableBase
 {
@@ -56,6 +61,8 @@ public:
 protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
+  virtual void residualSetup() override;
+  virtual void meshChanged() override;
 
   /// Size material property vectors and initialise with zeros
   void setMaterialVectorSize() const;
@@ -66,6 +73,20 @@ protected:
    */
   virtual void thermophysicalProperties() = 0;
 
+  /**
+   * The values that the flash calculation at the current point depends on, used to
+   * decide whether a stored flash calculation can be reused. Derived classes that
+   * couple to additional variables must append their values.
+   * @param[out] inputs gas porepressure, temperature and total mass fractions
+   */
+  virtual void flashInputs(std::vector<Real> & inputs) const;
+
+  /**
+   * Calculates the FluidStateProperties at the current point using thermophysicalProperties(),
+   * or copies them from the flash cache if the inputs are unchanged
+   */
+  void computeFluidStateProperties();
+
   /// Porepressure
   const VariableValue & _gas_porepressure;
   /// Gradient of porepressure (only defined at the qps)
@@ -130,6 +151,40 @@ protected:
   std::vector<FluidStateProperties> _fsp;
   /// Capillary pressure UserObject
   const PorousFlowCapillaryPressure & _pc_uo;
+  /**
+   * Initial guess and iteration count for the flash calculation at the current
+   * point (only valid during thermophysicalProperties())
+   */
+  FluidStateFlashGuess * _flash_guess;
+
+private:
+  /// Stored inputs and results of the flash calculation at a single point
+  struct FlashCacheEntry
+  {
+    std::vector<Real> inputs;
+    std::vector<FluidStateProperties> fsp;
+    FluidStateFlashGuess guess;
+  };
+
+  /// Resets the number of flash calculations and iterations
+  void resetFlashCounts();
+
+  /// Whether to store and reuse flash calculations
+  const bool _flash_cache;
+  /// Relative tolerance on the inputs for reusing a stored flash calculation
+  const Real _flash_cache_tol;
+  /// Whether to print the number of flash iterations (summed over all threads and processors) at each residual evaluation
+  const bool _print_flash_iterations;
+  /// Stored flash calculations, indexed by node id (nodal) or element id (qp)
+  std::unordered_map<dof_id_type, std::vector<FlashCacheEntry>> _flash_cache_data;
+  /// Inputs to the flash calculation at the current point
+  std::vector<Real> _flash_inputs;
+  /// Number of flash iterations since the last residual evaluation
+  unsigned long _flash_iterations;
+  /// Number of flash calculations since the last residual evaluation
+  unsigned long _num_flash;
+  /// Number of flash calculations reused from the cache since the last residual evaluation
+  unsigned long _num_cached_flash;
 };
 
 #endif // POROUSFLOWFLUIDSTATEFLASHBASE_H
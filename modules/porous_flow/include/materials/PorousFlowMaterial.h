@@ -14,6 +14,8 @@
 #include "MaterialData.h"
 #include "PorousFlowDictator.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class PorousFlowMaterial;
 
@@ -38,6 +40,13 @@ InputParameters validParams<PorousFlowMaterial>();
  * If number of quadpoints < number of nodes (eg for boundary elements)
  * care should be taken to store the required nodal information in
  * the first number_of_quadpoint elements in the std::vector!
+ *
+ * Nodal Materials whose properties depend only on the nodal values of
+ * the PorousFlow variables (and on other such nodal properties) may set
+ * _cache_nodal_values = true (subject to the nodal_value_cache parameter).
+ * Each node is then evaluated only once per element loop (per thread and
+ * subdomain), and the other elements sharing the node copy the cached
+ * values instead of calling computeQpProperties again.
  */
 class PorousFlowMaterial : public Material
 {
@@ -51,12 +60,24 @@ protected:
   /// correctly sizes nodal materials, then computes using Material::computeProperties
   virtual void computeProperties() override;
 
+  /// invalidate the nodal value cache since the solution may have changed
+  virtual void subdomainSetup() override;
+
+  /// invalidate the nodal value cache since node numbering may have changed
+  virtual void meshChanged() override;
+
   /// whether the derived class holds nodal values
   const bool _nodal_material;
 
   /// The variable names UserObject for the PorousFlow variables
   const PorousFlowDictator & _dictator;
 
+  /**
+   * Whether the nodal values computed by this Material are independent of
+   * the element, so they may be computed once per node and shared between elements
+   */
+  bool _cache_nodal_values;
+
   /**
    * Makes property with name prop_name to be size equal to
    * max(number of nodes, number of quadpoints) in the current element
@@ -76,6 +97,25 @@ protected:
    * @return the nearest quadpoint
    */
   unsigned nearestQP(unsigned nodenum) const;
+
+private:
+  /**
+   * Computes the nodal properties, evaluating computeQpProperties only at
+   * nodes that have not been evaluated since the cache was last cleared
+   */
+  void computeCachedNodalProperties();
+
+  /// Clears the nodal value cache
+  void clearNodalCache();
+
+  /// Ids of the properties supplied by this Material (in the order of _nodal_cache)
+  std::vector<unsigned int> _nodal_cache_prop_ids;
+
+  /// Cached nodal values of each supplied property, indexed by cache slot
+  std::vector<std::unique_ptr<PropertyValue>> _nodal_cache;
+
+  /// Maps node id to its slot in _nodal_cache
+  std::unordered_map<dof_id_type, unsigned int> _nodal_cache_slot;
 };
 
 #endif // POROUSFLOWMATERIAL_H
@@ -30,8 +30,15 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
+  /**
+   * Copies the fluid properties at point i of _batch into the material properties at _qp
+   * @param i index of the point in _batch
+   */
+  void assignQpProperties(std::size_t i);
+
   /// If true, this Material will compute density and viscosity, and their derivatives
   const bool _compute_rho_mu;
 
@@ -79,6 +86,18 @@ protected:
 
   /// Fluid properties UserObject
   const SinglePhaseFluidPropertiesPT & _fp;
+
+  /// Combination of FluidPropertiesBatch::Property flags for the properties computed
+  const unsigned int _batch_properties;
+
+  /// Pressure at the points passed to the fluid properties UserObject
+  std::vector<Real> _batch_pressure;
+
+  /// Temperature (K) at the points passed to the fluid properties UserObject
+  std::vector<Real> _batch_temperature;
+
+  /// Fluid properties computed by the fluid properties UserObject
+  FluidPropertiesBatch _batch;
 };
 
 #endif // POROUSFLOWSINGLECOMPONENTFLUID_H
@@ -55,7 +55,8 @@ public:
                                 Real temperature,
                                 Real xnacl,
                                 Real z,
-                                std::vector<FluidStateProperties> & fsp) const;
+                                std::vector<FluidStateProperties> & fsp,
+                                FluidStateFlashGuess * guess = nullptr) const;
 
   /**
    * Mole fractions of CO2 in water and water vapor in CO2 at equilibrium.
@@ -71,8 +72,13 @@ public:
    * @param temperature phase temperature (K)
    * @param[out] xco2 mole fraction of CO2 in liquid (-)
    * @param[out] yh2o mole fraction of H2O in gas (kg/kg)
+   * @param[in,out] guess optional initial guess for the iterative solve (updated on exit)
    */
-  void equilibriumMoleFractions(Real pressure, Real temperature, Real & xco2, Real & yh2o) const;
+  void equilibriumMoleFractions(Real pressure,
+                                Real temperature,
+                                Real & xco2,
+                                Real & yh2o,
+                                FluidStateFlashGuess * guess = nullptr) const;
 
   /**
    * Mass fractions of CO2 in brine and water vapor in CO2 at equilibrium
@@ -88,6 +94,7 @@ public:
    * @param[out] dyh2og_dp derivative of mass fraction of H2O in gas wrt pressure
    * @param[out] dyh2o_dT derivative of mass fraction of H2O in gas wrt temperature
    * @param[out] dyh2o_dx derivative of mass fraction of H2O in gas wrt salt mass fraction
+   * @param[in,out] guess optional initial guess for the iterative solve (updated on exit)
    */
   void equilibriumMassFractions(Real pressure,
                                 Real temperature,
@@ -99,7 +106,8 @@ public:
                                 Real & yh2o,
                                 Real & dyh2o_dp,
                                 Real & dyh2o_dT,
-                                Real & dyh2o_dx) const;
+                                Real & dyh2o_dx,
+                                FluidStateFlashGuess * guess = nullptr) const;
 
   /**
    * Mass fractions of CO2 and H2O in both phases, as well as derivatives wrt
@@ -111,13 +119,15 @@ public:
    * @param z total mass fraction of CO2 component
    * @param[out] PhaseStateEnum current phase state
    * @param[out] FluidStateMassFractions data structure
+   * @param[in,out] guess optional initial guess for the iterative solve (updated on exit)
    */
   void massFractions(Real pressure,
                      Real temperature,
                      Real xnacl,
                      Real z,
                      FluidStatePhaseEnum & phase_state,
-                     std::vector<FluidStateProperties> & fsp) const;
+                     std::vector<FluidStateProperties> & fsp,
+                     FluidStateFlashGuess * guess = nullptr) const;
 
   /**
    * Thermophysical properties of the gaseous state
@@ -407,8 +417,14 @@ public:
    * @param temperature fluid temperature (K)
    * @param[out] xco2 mole fraction of CO2 in liquid phase (-)
    * @param[out] yh2o mole fraction of H2O in gas phase (-)
+   * @param[in,out] guess optional initial guess for yh2o. If supplied, the converged yh2o
+   *                and the number of iterations are returned in it
    */
-  void solveEquilibriumHighTemp(Real pressure, Real temperature, Real & xco2, Real & yh2o) const;
+  void solveEquilibriumHighTemp(Real pressure,
+                                Real temperature,
+                                Real & xco2,
+                                Real & yh2o,
+                                FluidStateFlashGuess * guess = nullptr) const;
 
 protected:
   /// Check the input variables
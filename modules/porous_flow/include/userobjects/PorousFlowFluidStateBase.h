@@ -75,6 +75,23 @@ struct FluidStateProperties
   std::vector<Real> dmass_fraction_dx;
 };
 
+/**
+ * Data structure carried between successive flash calculations at the same point.
+ * The last converged equilibrium solution is used as the initial guess for any
+ * iterative solve, and the number of iterations taken is returned
+ */
+struct FluidStateFlashGuess
+{
+  FluidStateFlashGuess() : yh2o(-1.0), xco2(0.0), iterations(0) {}
+
+  /// Converged mole fraction of H2O in the gas phase (negative if not yet available)
+  Real yh2o;
+  /// Converged mole fraction of the gas component in the liquid phase
+  Real xco2;
+  /// Number of iterations taken by the last flash calculation
+  unsigned int iterations;
+};
+
 template <>
 InputParameters validParams<PorousFlowFluidStateBase>();
 
@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef INTERNALSIDEFLUXRATE_H
+#define INTERNALSIDEFLUXRATE_H
+
+#include "GeneralPostprocessor.h"
+
+class InternalSideFluxRate;
+class InternalSideFluxBase;
+
+template <>
+InputParameters validParams<InternalSideFluxRate>();
+
+/**
+ * Reports the number of internal sides whose fluxes are computed per second of flux evaluation
+ */
+class InternalSideFluxRate : public GeneralPostprocessor
+{
+public:
+  InternalSideFluxRate(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// the internal side flux
+  const InternalSideFluxBase & _flux;
+};
+
+#endif
@@ -0,0 +1,98 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef AEFVBATCHUPWINDINTERNALSIDEFLUXONED_H
+#define AEFVBATCHUPWINDINTERNALSIDEFLUXONED_H
+
+#include "AEFVUpwindInternalSideFlux.h"
+
+class AEFVBatchUpwindInternalSideFluxOneD;
+class SlopeLimitingBase;
+
+template <>
+InputParameters validParams<AEFVBatchUpwindInternalSideFluxOneD>();
+
+/**
+ * Upwind numerical flux scheme
+ * for the advection equation
+ * using a cell-centered finite volume method,
+ * with the fluxes of all local internal sides of a one-dimensional mesh computed in blocks of
+ * sides
+ *
+ * This is a benchmark of the evaluation of the fluxes in blocks (see RDGAdvectionFlux::upwind)
+ * against AEFVUpwindInternalSideFlux, not a general batched flux path.
+ *
+ * Notes:
+ *
+ *   1. When this object executes, the variable is reconstructed at the centroid of each side
+ *      using the limited slopes of the elements on both sides, and the fluxes are evaluated for
+ *      blocks of sides at once. The fluxes are then returned by `getFlux` without computing them
+ *      for each side, so the variable values passed to `getFlux` must be the same reconstructed
+ *      values, e.g. those computed by AEFVMaterial.
+ *
+ *   2. The Jacobians, and the fluxes of sides that were not computed in blocks, are computed for
+ *      each side as in AEFVUpwindInternalSideFlux.
+ *
+ *   3. The side centroid is the quadrature point of the side only in 1D, so this object can only
+ *      be used on one-dimensional meshes.
+ */
+class AEFVBatchUpwindInternalSideFluxOneD : public AEFVUpwindInternalSideFlux
+{
+public:
+  AEFVBatchUpwindInternalSideFluxOneD(const InputParameters & parameters);
+
+  virtual void execute() override;
+  virtual void meshChanged() override;
+
+  virtual const std::vector<Real> & getFlux(unsigned int iside,
+                                            dof_id_type ielem,
+                                            dof_id_type ineig,
+                                            const std::vector<Real> & uvec1,
+                                            const std::vector<Real> & uvec2,
+                                            const RealVectorValue & dwave,
+                                            THREAD_ID tid) const override;
+
+protected:
+  /// cache the sides computed in blocks and their geometry
+  void cacheSides();
+
+  /// the variable
+  MooseVariable & _u;
+
+  /// slope limiting user object
+  const SlopeLimitingBase & _lslope;
+
+  /// number of sides in each block
+  const unsigned int _block_size;
+
+  /// flag to indicate if the sides are cached
+  bool _sides_cached;
+
+  /// index of each side, indexed by pair of element ID and neighbor ID
+  std::unordered_map<RDGFaceCache::Key, unsigned int, RDGFaceCache::KeyHash> _side_index;
+
+  ///@{ data of each side, stored as a structure of arrays
+  std::vector<const Elem *> _side_elem1;
+  std::vector<const Elem *> _side_elem2;
+  std::vector<RealVectorValue> _side_dvec1;
+  std::vector<RealVectorValue> _side_dvec2;
+  std::vector<Real> _side_vdon;
+  ///@}
+
+  ///@{ data of the current block of sides
+  std::vector<Real> _block_u1;
+  std::vector<Real> _block_u2;
+  std::vector<Real> _block_flux;
+  ///@}
+
+  /// flux vector of each side
+  std::vector<std::vector<Real>> _side_flux;
+};
+
+#endif
@@ -30,7 +30,8 @@ public:
   AEFVSlopeLimitingOneD(const InputParameters & parameters);
 
   /// compute the limited slope of the cell
-  virtual std::vector<RealGradient> limitElementSlope() const override;
+  virtual void limitElementSlope(const Elem * elem,
+                                 std::vector<RealGradient> & slope) const override;
 
 protected:
   /// the input variable
@@ -38,6 +39,9 @@ protected:
 
   /// One-D slope limiting scheme
   MooseEnum _scheme;
+
+  /// small number in the weights of the WENO-type scheme
+  const Real _weno_epsilon;
 };
 
 #endif
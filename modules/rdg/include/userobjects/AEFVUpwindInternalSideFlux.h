@@ -47,6 +47,8 @@ public:
                             DenseMatrix<Real> & jac2) const override;
 
 protected:
+  /// constant advection velocity
+  const RealVectorValue _velocity;
 };
 
 #endif
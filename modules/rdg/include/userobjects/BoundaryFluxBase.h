@@ -11,6 +11,7 @@
 #define BOUNDARYFLUXBASE_H
 
 #include "GeneralUserObject.h"
+#include "RDGFaceCache.h"
 
 // Forward Declarations
 class BoundaryFluxBase;
@@ -28,6 +29,9 @@ InputParameters validParams<BoundaryFluxBase>();
  *      and then when it is needed, we just return the cached value.
  *
  *   2. Derived classes need to override `calcFlux` and `calcJacobian`.
+ *
+ *   3. The fluxes of all boundary sides are cached until the next execution of this object,
+ *      which must therefore execute on "linear" to be cleared before each residual evaluation.
  */
 class BoundaryFluxBase : public GeneralUserObject
 {
@@ -93,17 +97,8 @@ public:
                             DenseMatrix<Real> & jac1) const = 0;
 
 protected:
-  mutable unsigned int _cached_side_id;
-  mutable dof_id_type _cached_elem_id;
-
-  /// Threaded storage for fluxes
-  mutable std::vector<std::vector<Real>> _flux;
-
-  /// Threaded storage for jacobians
-  mutable std::vector<DenseMatrix<Real>> _jac1;
-
-private:
-  static Threads::spin_mutex _mutex;
+  /// Threaded storage for fluxes and jacobians, indexed by element ID and side ID
+  mutable std::vector<RDGFaceCache> _cache;
 };
 
 #endif // BOUNDARYFLUXBASE_H
@@ -24,6 +24,8 @@
 #include "libmesh/elem.h"
 #include "libmesh/parallel_algebra.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class ElementLoopUserObject;
 
@@ -55,6 +57,14 @@ InputParameters validParams<ElementLoopUserObject>();
  *      Second, another element-loop is required to calculate the limited in-cell gradients of
  * variables
  *      based on the reconstructed gradients from the element and its face-neighboring elements.
+ *
+ *   2. the elements of the loop and their face-neighbors on other processors are assigned a
+ *      contiguous local index (see localElemIndex), so that derived classes can store element data
+ *      in arrays rather than in maps indexed by element ID.
+ *
+ *   3. derived classes that set _threaded_element_loop compute the elements with
+ *      computeElementThreaded() using all available threads, in this case the side callbacks are
+ *      not used.
  */
 class ElementLoopUserObject : public GeneralUserObject,
                               public BlockRestrictable,
@@ -83,6 +93,20 @@ public:
 
   void join(const ElementLoopUserObject & /*y*/);
 
+  /**
+   * Compute an element of a threaded element loop, this must only modify the data of the element
+   * @param[in] elem   the element to compute
+   * @param[in] tid    thread ID
+   */
+  virtual void computeElementThreaded(const Elem * elem, THREAD_ID tid);
+
+  /**
+   * Get the index of an element in the local element data
+   * @param[in] elem_id   global ID of the element
+   * @return the local index, or libMesh::invalid_uint if the element is not indexed
+   */
+  unsigned int localElemIndex(dof_id_type elem_id) const;
+
 protected:
   virtual void caughtMooseException(MooseException & e);
 
@@ -98,11 +122,29 @@ protected:
   const MooseArray<Real> & _JxW;
   const MooseArray<Real> & _coord;
 
+  /**
+   * Add an element to the local element index
+   * @param[in] elem_id   global ID of the element
+   * @return the local index of the element
+   */
+  unsigned int addLocalElemIndex(dof_id_type elem_id);
+
+  /**
+   * Cache the local element index and the interface elements
+   */
+  virtual void buildLocalElemIndex();
+
   /// true if we have cached interface elements, false if they need to be cached. We want to (re)cache only when mesh changed
   bool _have_interface_elems;
   /// List of element IDs that are on the processor boundary and need to be send to other processors
   std::set<dof_id_type> _interface_elem_ids;
 
+  /// Local index of the elements of the loop, followed by their neighbors on other processors
+  std::unordered_map<dof_id_type, unsigned int> _local_elem_index;
+
+  /// true if the elements are computed by computeElementThreaded() using all available threads
+  bool _threaded_element_loop;
+
   /// The subdomain for the current element
   SubdomainID _subdomain;
 
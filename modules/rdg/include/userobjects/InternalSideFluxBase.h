@@ -11,6 +11,7 @@
 #define INTERNALSIDEFLUXBASE_H
 
 #include "GeneralUserObject.h"
+#include "RDGFaceCache.h"
 
 // Forward Declarations
 class InternalSideFluxBase;
@@ -30,6 +31,13 @@ InputParameters validParams<InternalSideFluxBase>();
  *
  *   2. Derived classes need to provide computing of the fluxes and their jacobians,
  *      i.e., they need to implement `calcFlux` and `calcJacobian`.
+ *
+ *   3. The fluxes of all sides are cached until the next execution of this object,
+ *      which must therefore execute on "linear" to be cleared before each residual evaluation.
+ *
+ *   4. When `measure_flux_rate` is set, the number of sides whose fluxes are computed and the
+ *      time spent computing them are accumulated, so that the rate of the flux evaluation can be
+ *      reported (see `faceRate`).
  */
 class InternalSideFluxBase : public GeneralUserObject
 {
@@ -113,19 +121,24 @@ public:
                             DenseMatrix<Real> & jac1,
                             DenseMatrix<Real> & jac2) const = 0;
 
+  /// whether the flux evaluation is timed
+  bool measuresFluxRate() const { return _measure_flux_rate; }
+
+  /// number of sides whose fluxes are computed per second of flux evaluation, over all threads
+  Real faceRate() const;
+
 protected:
-  mutable unsigned int _cached_elem_id;
-  mutable unsigned int _cached_neig_id;
-
-  /// flux vector of this side
-  mutable std::vector<std::vector<Real>> _flux;
-  /// Jacobian matrix contribution to the "left" cell
-  mutable std::vector<DenseMatrix<Real>> _jac1;
-  /// Jacobian matrix contribution to the "right" cell
-  mutable std::vector<DenseMatrix<Real>> _jac2;
-
-private:
-  static Threads::spin_mutex _mutex;
+  /// whether to time the flux evaluation
+  const bool _measure_flux_rate;
+
+  /// cached fluxes and Jacobians for each thread, indexed by element ID and neighbor ID
+  mutable std::vector<RDGFaceCache> _cache;
+
+  /// number of sides whose fluxes were computed by each thread
+  mutable std::vector<Real> _computed_sides;
+
+  /// time spent computing the fluxes by each thread
+  mutable std::vector<Real> _compute_time;
 };
 
 #endif // INTERNALSIDEFLUXBASE_H
@@ -11,6 +11,7 @@
 #define RDGFLUXBASE_H
 
 #include "GeneralUserObject.h"
+#include "RDGFaceCache.h"
 
 class RDGFluxBase;
 
@@ -22,7 +23,9 @@ InputParameters validParams<RDGFluxBase>();
  *
  * Here a call to compute flux computes the flux for all equations in the system,
  * so to avoid duplicating the calculations, a wrapper is used to cache the
- * system flux for an element/side combination.
+ * system flux for an element/side combination. The fluxes of all element/side
+ * combinations are cached until the next execution of this object, which must
+ * therefore execute on "linear" to be cleared before each residual evaluation.
  */
 class RDGFluxBase : public GeneralUserObject
 {
@@ -117,21 +120,8 @@ public:
                             DenseMatrix<Real> & jac2) const = 0;
 
 protected:
-  /// element ID of the cached values
-  mutable unsigned int _cached_elem_id;
-  /// side ID of the cached values
-  mutable unsigned int _cached_side_id;
-
-  /// flux vector
-  mutable std::vector<std::vector<Real>> _flux;
-  /// Jacobian matrix contribution to the "left" cell
-  mutable std::vector<DenseMatrix<Real>> _jac1;
-  /// Jacobian matrix contribution to the "right" cell
-  mutable std::vector<DenseMatrix<Real>> _jac2;
-
-private:
-  /// mutual exclusion object for threading
-  static Threads::spin_mutex _mutex;
+  /// cached fluxes and Jacobians for each thread, indexed by element ID and side ID
+  mutable std::vector<RDGFaceCache> _cache;
 };
 
 #endif // RDGFLUXBASE_H
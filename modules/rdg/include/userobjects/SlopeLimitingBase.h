@@ -21,6 +21,8 @@ InputParameters validParams<SlopeLimitingBase>();
 /**
  * Base class for slope limiting to limit
  * the slopes of cell average variables
+ *
+ * The elements are limited using all available threads, so limitElementSlope must be thread safe.
  */
 class SlopeLimitingBase : public ElementLoopUserObject
 {
@@ -31,19 +33,24 @@ public:
   virtual void finalize();
 
   virtual void computeElement();
+  virtual void computeElementThreaded(const Elem * elem, THREAD_ID tid);
 
   /// accessor function call
   virtual const std::vector<RealGradient> & getElementSlope(dof_id_type elementid) const;
 
-  /// compute the slope of the cell
-  virtual std::vector<RealGradient> limitElementSlope() const = 0;
+  /**
+   * compute the limited slope of the cell
+   * @param[in]   elem     the element to limit
+   * @param[out]  slope    the limited slope of each variable
+   */
+  virtual void limitElementSlope(const Elem * elem, std::vector<RealGradient> & slope) const = 0;
 
 protected:
   virtual void serialize(std::string & serialized_buffer);
   virtual void deserialize(std::vector<std::string> & serialized_buffers);
 
-  /// store the updated slopes into this map indexed by element ID
-  std::map<dof_id_type, std::vector<RealGradient>> _lslope;
+  /// store the updated slopes into this array indexed by local element index
+  std::vector<std::vector<RealGradient>> _lslope;
 
   /// option whether to include BCs
   bool _include_bc;
@@ -62,9 +69,6 @@ protected:
 
   /// the neighboring element
   const Elem *& _neighbor_elem;
-
-private:
-  static Threads::spin_mutex _mutex;
 };
 
 #endif
@@ -70,11 +70,11 @@ protected:
   virtual void serialize(std::string & serialized_buffer);
   virtual void deserialize(std::vector<std::string> & serialized_buffers);
 
-  /// store the reconstructed slopes into this map indexed by element ID
-  std::map<dof_id_type, std::vector<RealGradient>> _rslope;
+  /// store the reconstructed slopes into this array indexed by local element index
+  std::vector<std::vector<RealGradient>> _rslope;
 
-  /// store the average variable values into this map indexed by element ID
-  std::map<dof_id_type, std::vector<Real>> _avars;
+  /// store the average variable values into this array indexed by local element index
+  std::vector<std::vector<Real>> _avars;
 
   /// store the boundary average variable values into this map indexed by pair of element ID and local side ID
   std::map<std::pair<dof_id_type, unsigned int>, std::vector<Real>> _bnd_avars;
@@ -0,0 +1,54 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef RDGADVECTIONFLUX_H
+#define RDGADVECTIONFLUX_H
+
+#include "MooseTypes.h"
+
+#include <cmath>
+
+/**
+ * Numerical fluxes of the advection equation evaluated for blocks of faces
+ *
+ * The face data is passed as a structure of arrays, one array for each quantity with an entry for
+ * each face, so that the loops over the faces do not branch and can be vectorized by the compiler.
+ * For the linear advection equation the Rusanov, Roe and HLLC fluxes reduce to the upwind flux.
+ */
+namespace RDGAdvectionFlux
+{
+/**
+ * Compute the upwind flux for a block of faces
+ * @param[in]   n      number of faces
+ * @param[in]   ul     variable on the "left" of each face
+ * @param[in]   ur     variable on the "right" of each face
+ * @param[in]   vnl    normal velocity on the "left" of each face
+ * @param[in]   vnr    normal velocity on the "right" of each face
+ * @param[out]  flux   flux across each face
+ */
+inline void
+upwind(std::size_t n,
+       const Real * ul,
+       const Real * ur,
+       const Real * vnl,
+       const Real * vnr,
+       Real * flux)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    // calculate the so-called a^plus and a^minus
+    const Real aplus = 0.5 * (vnl[i] + std::abs(vnl[i]));
+    const Real amins = 0.5 * (vnr[i] - std::abs(vnr[i]));
+
+    flux[i] = aplus * ul[i] + amins * ur[i];
+  }
+}
+}
+
+#endif // RDGADVECTIONFLUX_H
@@ -0,0 +1,97 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef RDGFACECACHE_H
+#define RDGFACECACHE_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/dense_matrix.h"
+
+#include <deque>
+#include <unordered_map>
+
+/**
+ * Storage for the fluxes and flux Jacobians of all faces visited by a thread during a residual or
+ * Jacobian evaluation
+ *
+ * A face is identified by a pair of IDs, e.g. the element and neighbor IDs for an internal side or
+ * the element ID and local side index for a boundary side. The values are stored contiguously and
+ * are kept when the cache is cleared, so that they are reused without reallocation by the next
+ * evaluation. References to the values stay valid until the cache is cleared.
+ */
+class RDGFaceCache
+{
+public:
+  typedef std::pair<dof_id_type, dof_id_type> Key;
+  typedef std::pair<DenseMatrix<Real>, DenseMatrix<Real>> JacobianPair;
+
+  /// hash of a face, for storing faces in unordered containers
+  struct KeyHash
+  {
+    std::size_t operator()(const Key & key) const
+    {
+      return std::hash<dof_id_type>()(key.first) * 31 + std::hash<dof_id_type>()(key.second);
+    }
+  };
+
+  /// Remove all faces from the cache
+  void clear()
+  {
+    _flux_index.clear();
+    _jacobian_index.clear();
+  }
+
+  /**
+   * Get the flux of a face
+   * @param[in]   key       the face
+   * @param[out]  cached    true if the flux of the face was already stored
+   */
+  std::vector<Real> & flux(const Key & key, bool & cached)
+  {
+    return find(_flux_index, _flux, key, cached);
+  }
+
+  /**
+   * Get the flux Jacobians of a face
+   * @param[in]   key       the face
+   * @param[out]  cached    true if the Jacobians of the face were already stored
+   */
+  JacobianPair & jacobian(const Key & key, bool & cached)
+  {
+    return find(_jacobian_index, _jacobian, key, cached);
+  }
+
+private:
+  typedef std::unordered_map<Key, unsigned int, KeyHash> Index;
+
+  template <typename T>
+  T & find(Index & index, std::deque<T> & values, const Key & key, bool & cached)
+  {
+    auto pos = index.emplace(key, index.size());
+    cached = !pos.second;
+
+    const unsigned int i = pos.first->second;
+    if (i == values.size())
+      values.emplace_back();
+    return values[i];
+  }
+
+  /// position of each face in the flux storage
+  Index _flux_index;
+  /// flux storage
+  std::deque<std::vector<Real>> _flux;
+
+  /// position of each face in the Jacobian storage
+  Index _jacobian_index;
+  /// Jacobian storage
+  std::deque<JacobianPair> _jacobian;
+};
+
+#endif // RDGFACECACHE_H
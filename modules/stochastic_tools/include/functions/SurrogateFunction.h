@@ -0,0 +1,45 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SURROGATEFUNCTION_H
+#define SURROGATEFUNCTION_H
+
+#include "Function.h"
+
+class SurrogateFunction;
+class SurrogateModel;
+
+template <>
+InputParameters validParams<SurrogateFunction>();
+
+/**
+ * A Function that evaluates a SurrogateModel using the spatial coordinates and time as the
+ * model inputs.
+ */
+class SurrogateFunction : public Function
+{
+public:
+  SurrogateFunction(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual Real value(Real t, const Point & p) override;
+
+protected:
+  /// The model to evaluate, a pointer is used because UserObjects are not available during the
+  /// construction of the Function
+  const SurrogateModel * _model;
+
+  /// The coordinate used for each model input, the time is indicated by LIBMESH_DIM
+  std::vector<unsigned int> _components;
+
+  /// Storage for the model inputs
+  std::vector<Real> _inputs;
+};
+
+#endif /* SURROGATEFUNCTION_H */
@@ -16,6 +16,8 @@
 #include "Sampler.h"
 
 class SamplerMultiApp;
+class SamplerTransfer;
+class SamplerPostprocessorTransfer;
 
 template <>
 InputParameters validParams<SamplerMultiApp>();
@@ -25,14 +27,54 @@ class SamplerMultiApp : public TransientMultiApp, public SamplerInterface
 public:
   SamplerMultiApp(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+  virtual void incrementTStep() override;
+  virtual void finishStep() override;
+  virtual bool needsRestoration() override;
+
   /**
    * Return the Sampler object for this MultiApp.
    */
   Sampler & getSampler() const { return _sampler; }
 
+  /**
+   * Return true if the sub-applications are reused for successive samples.
+   */
+  bool isBatchMode() const { return _batch_mode; }
+
+  /**
+   * Register a transfer to be executed for each sample when operating in batch mode.
+   *
+   * These methods are called by the SamplerTransfer and SamplerPostprocessorTransfer objects.
+   */
+  void addBatchTransfer(SamplerTransfer * transfer);
+  void addBatchTransfer(SamplerPostprocessorTransfer * transfer);
+
 protected:
   /// Sampler to utilize for creating MultiApps
   Sampler & _sampler;
+
+  /// Flag for re-running a single sub-application on each processor for all of the samples
+  const bool _batch_mode;
+
+  /// The first sample (global row index) computed by the local sub-application in batch mode
+  unsigned int _first_local_row;
+
+  /// The number of samples computed by the local sub-application in batch mode
+  unsigned int _num_local_rows;
+
+  /// The Sampler execution (see Sampler::getExecuteCount) for which the samples were last solved
+  unsigned int _batch_execute_count;
+
+  /// The state of the sub-application following initialization, restored after each sample
+  std::shared_ptr<Backup> _batch_backup;
+
+  /// Transfers that apply the Sampler data for each sample in batch mode
+  std::vector<SamplerTransfer *> _batch_to_transfers;
+
+  /// Transfers that collect the results for each sample in batch mode
+  std::vector<SamplerPostprocessorTransfer *> _batch_from_transfers;
 };
 
 #endif
@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SURROGATECROSSVALIDATIONERROR_H
+#define SURROGATECROSSVALIDATIONERROR_H
+
+#include "GeneralPostprocessor.h"
+
+class SurrogateCrossValidationError;
+class SurrogateModel;
+
+template <>
+InputParameters validParams<SurrogateCrossValidationError>();
+
+/**
+ * Report the cross-validation error computed during the training of a SurrogateModel.
+ */
+class SurrogateCrossValidationError : public GeneralPostprocessor
+{
+public:
+  SurrogateCrossValidationError(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The model that computes the error
+  const SurrogateModel & _model;
+};
+
+#endif /* SURROGATECROSSVALIDATIONERROR_H */
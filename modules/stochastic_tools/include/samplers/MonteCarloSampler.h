@@ -26,6 +26,9 @@ public:
 
 protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
+  virtual Real
+  computeSample(unsigned int matrix_index, unsigned int row_index, unsigned int col_index) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
 
   /// Number of monte carlo samples to create for each distribution
   const std::size_t _num_samples;
@@ -0,0 +1,55 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef QUADRATURESAMPLER_H
+#define QUADRATURESAMPLER_H
+
+#include "Sampler.h"
+
+class QuadratureSampler;
+
+template <>
+InputParameters validParams<QuadratureSampler>();
+
+/**
+ * A class that creates the tensor product of Gauss-Legendre quadrature points, in terms of the
+ * cumulative probability of each distribution, for use with a PolynomialChaos surrogate model.
+ */
+class QuadratureSampler : public Sampler
+{
+public:
+  QuadratureSampler(const InputParameters & parameters);
+
+  /**
+   * Return the quadrature weight for each row of the samples, the weights sum to one.
+   */
+  std::vector<Real> getQuadratureWeights() const;
+
+protected:
+  virtual std::vector<DenseMatrix<Real>> sample() override;
+  virtual Real
+  computeSample(unsigned int matrix_index, unsigned int row_index, unsigned int col_index) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
+
+  /**
+   * Return the index of the one-dimensional quadrature point for the given row and column.
+   */
+  unsigned int pointIndex(unsigned int row_index, unsigned int col_index) const;
+
+  /// One-dimensional Gauss-Legendre points on [-1, 1]
+  std::vector<Real> _points;
+
+  /// One-dimensional Gauss-Legendre weights, normalized to sum to one
+  std::vector<Real> _weights;
+
+  /// Total number of quadrature points
+  unsigned int _num_rows;
+};
+
+#endif /* QUADRATURESAMPLER_H */
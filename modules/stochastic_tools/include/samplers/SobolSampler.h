@@ -28,6 +28,9 @@ protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
   virtual void sampleSetUp() override;
   virtual void sampleTearDown() override;
+  virtual Real
+  computeSample(unsigned int matrix_index, unsigned int row_index, unsigned int col_index) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
 
   /// Number of Monte Carlo samples to create for each Sobol matrix
   const std::size_t _num_samples;
@@ -32,6 +32,20 @@ public:
   SamplerPostprocessorTransfer(const InputParameters & parameters);
   virtual void initialSetup() override;
 
+  /**
+   * Store the Postprocessor value of a sub-application for a single sample, this is called by
+   * the SamplerMultiApp after each sample when operating in batch mode.
+   * @param app_index The global sub-app index
+   * @param row_index The global row index, across all of the Sampler matrices
+   */
+  void collectSample(unsigned int app_index, unsigned int row_index);
+
+  /**
+   * Remove the stored Postprocessor values, this is called by the SamplerMultiApp before a new
+   * set of samples is computed when operating in batch mode.
+   */
+  void clearSamples();
+
 protected:
   virtual void executeFromMultiapp() override;
 
@@ -43,6 +57,15 @@ protected:
 
   /// Storage for StochasticResults object that data will be transferred to/from
   StochasticResults * _results;
+
+  /// Global row index of the samples computed locally
+  std::vector<unsigned int> _sample_rows;
+
+  /// Postprocessor values of the samples computed locally
+  std::vector<PostprocessorValue> _sample_values;
+
+  /// True when the stored values have been gathered from all processors
+  bool _gathered;
 };
 
 #endif
@@ -30,6 +30,17 @@ public:
   SamplerTransfer(const InputParameters & parameters);
   virtual void execute() override;
 
+  /**
+   * Copy a row of the Sampler data to the SamplerReceiver of a sub-application.
+   * @param app_index The global sub-app index
+   * @param row_index The global row index, across all of the Sampler matrices
+   * @param samples The data returned by Sampler::getSamples(), which is not used for a
+   *                distributed Sampler
+   */
+  void transferSample(unsigned int app_index,
+                      unsigned int row_index,
+                      const std::vector<DenseMatrix<Real>> & samples);
+
 protected:
   /**
    * Return the SamplerReceiver object and perform error checking.
@@ -46,8 +57,8 @@ protected:
   /// The name of the SamplerReceiver Control object on the sub-application
   const std::string & _receiver_name;
 
-  /// The matrix and row for each MultiApp
-  std::vector<std::pair<unsigned int, unsigned int>> _multi_app_matrix_row;
+  /// True when the SamplerMultiApp reuses the sub-applications for successive samples
+  bool _batch_mode;
 };
 
 #endif
@@ -0,0 +1,69 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef GAUSSIANPROCESS_H
+#define GAUSSIANPROCESS_H
+
+#include "SurrogateModel.h"
+
+class GaussianProcess;
+
+template <>
+InputParameters validParams<GaussianProcess>();
+
+/**
+ * Gaussian process regression with a squared exponential covariance, the inputs and results are
+ * standardized so that the hyperparameters are in units of their standard deviations.
+ */
+class GaussianProcess : public SurrogateModel
+{
+public:
+  GaussianProcess(const InputParameters & parameters);
+
+  virtual Real evaluate(const std::vector<Real> & x) const override;
+
+protected:
+  virtual void train(const DenseMatrix<Real> & x, const std::vector<Real> & y) override;
+  virtual void store(std::ostream & stream) const override;
+  virtual void load(std::istream & stream) override;
+
+  /**
+   * Compute the covariance between two standardized inputs.
+   */
+  Real covariance(const std::vector<Real> & a, const std::vector<Real> & b) const;
+
+  /// The correlation length of each standardized input
+  std::vector<Real> _length_factor;
+
+  /// The variance of the standardized results
+  Real _signal_variance;
+
+  /// The noise variance of the standardized results
+  Real _noise_variance;
+
+  ///@{
+  /// The mean and standard deviation of each input
+  std::vector<Real> _x_mean;
+  std::vector<Real> _x_std;
+  ///@}
+
+  ///@{
+  /// The mean and standard deviation of the results
+  Real _y_mean;
+  Real _y_std;
+  ///@}
+
+  /// The standardized training inputs
+  std::vector<std::vector<Real>> _points;
+
+  /// The training weights, the inverse covariance matrix multiplied by the standardized results
+  std::vector<Real> _alpha;
+};
+
+#endif /* GAUSSIANPROCESS_H */
@@ -0,0 +1,76 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef POLYNOMIALCHAOS_H
+#define POLYNOMIALCHAOS_H
+
+#include "SurrogateModel.h"
+#include "DistributionInterface.h"
+
+class PolynomialChaos;
+class QuadratureSampler;
+class Distribution;
+
+template <>
+InputParameters validParams<PolynomialChaos>();
+
+/**
+ * A polynomial chaos expansion using orthonormal Legendre polynomials of the cumulative
+ * probability of each input, the coefficients are computed with least-squares regression or with
+ * the quadrature of a QuadratureSampler.
+ */
+class PolynomialChaos : public SurrogateModel, public DistributionInterface
+{
+public:
+  PolynomialChaos(const InputParameters & parameters);
+
+  virtual Real evaluate(const std::vector<Real> & x) const override;
+
+protected:
+  virtual void train(const DenseMatrix<Real> & x, const std::vector<Real> & y) override;
+  virtual void store(std::ostream & stream) const override;
+  virtual void load(std::istream & stream) override;
+
+  /**
+   * Build the total degree multi-indices for the current order.
+   */
+  void buildMultiIndices();
+
+  /**
+   * Compute the orthonormal polynomials of each input up to the current order.
+   * @param x The input parameters
+   * @return The polynomial values, indexed by input and then by degree
+   */
+  std::vector<std::vector<Real>> polynomials(const std::vector<Real> & x) const;
+
+  /**
+   * Compute the value of each term of the expansion, without the coefficients.
+   */
+  std::vector<Real> terms(const std::vector<Real> & x) const;
+
+  /// Method used for computing the coefficients
+  const MooseEnum & _method;
+
+  /// The distributions of the inputs
+  std::vector<Distribution *> _distributions;
+
+  /// The Sampler providing the quadrature weights, when "method = quadrature"
+  QuadratureSampler * _quadrature_sampler;
+
+  /// The maximum total degree of the expansion
+  unsigned int _order;
+
+  /// The degree of each polynomial in each term of the expansion
+  std::vector<std::vector<unsigned int>> _multi_indices;
+
+  /// The coefficient of each term of the expansion
+  std::vector<Real> _coefficients;
+};
+
+#endif /* POLYNOMIALCHAOS_H */
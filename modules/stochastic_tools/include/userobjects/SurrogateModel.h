@@ -0,0 +1,94 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SURROGATEMODEL_H
+#define SURROGATEMODEL_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+#include "SamplerInterface.h"
+
+#include "libmesh/dense_matrix.h"
+
+class SurrogateModel;
+class Sampler;
+
+template <>
+InputParameters validParams<SurrogateModel>();
+
+/**
+ * Base class for surrogate models, which approximate the result of a sub-application as a
+ * function of the sampled parameters.
+ *
+ * The model is trained using the samples of a Sampler and the values stored in a
+ * StochasticResults object (see SamplerPostprocessorTransfer), or it is read from a file written
+ * by a previous training. Once trained, the evaluate method may be used in place of the
+ * sub-application.
+ */
+class SurrogateModel : public GeneralUserObject, public SamplerInterface
+{
+public:
+  SurrogateModel(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /**
+   * Evaluate the trained model.
+   * @param x The input parameters, in the same order as the columns of the Sampler data
+   */
+  virtual Real evaluate(const std::vector<Real> & x) const = 0;
+
+  /**
+   * Return the root mean square error of the k-fold cross-validation, this is zero if
+   * "cv_folds" was not supplied.
+   */
+  Real crossValidationError() const { return _cv_error; }
+
+protected:
+  /**
+   * Train the model.
+   * @param x The training inputs, one row for each sample
+   * @param y The training results for each sample
+   */
+  virtual void train(const DenseMatrix<Real> & x, const std::vector<Real> & y) = 0;
+
+  ///@{
+  /**
+   * Write or read the trained model data, which does not include the type of the model.
+   */
+  virtual void store(std::ostream & stream) const = 0;
+  virtual void load(std::istream & stream) = 0;
+  ///@}
+
+  /**
+   * Compute the root mean square error of k-fold cross-validation by training the model with
+   * the samples outside of each fold and evaluating it for the samples within the fold.
+   */
+  Real computeCrossValidationError(const DenseMatrix<Real> & x, const std::vector<Real> & y);
+
+  /// Sampler providing the training inputs
+  Sampler * _sampler;
+
+  /// The training results
+  const VectorPostprocessorValue * _results;
+
+  /// The name of the vector containing the training results
+  const std::string & _results_vector;
+
+  /// Number of folds used for cross-validation
+  const unsigned int _cv_folds;
+
+  /// The cross-validation error
+  Real _cv_error;
+};
+
+#endif
@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EVALUATESURROGATE_H
+#define EVALUATESURROGATE_H
+
+#include "GeneralVectorPostprocessor.h"
+#include "SamplerInterface.h"
+
+class EvaluateSurrogate;
+class SurrogateModel;
+
+template <>
+InputParameters validParams<EvaluateSurrogate>();
+
+/**
+ * Evaluate a SurrogateModel for each row of the Sampler data, the results are stored in a vector
+ * for each matrix of the Sampler.
+ */
+class EvaluateSurrogate : public GeneralVectorPostprocessor, SamplerInterface
+{
+public:
+  EvaluateSurrogate(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+
+protected:
+  /// The model to evaluate
+  const SurrogateModel & _model;
+
+  /// The Sampler providing the model inputs
+  Sampler & _sampler;
+
+  /// Storage for declared vectors, one for each Sampler matrix
+  std::vector<VectorPostprocessorValue *> _sample_vectors;
+};
+
+#endif /* EVALUATESURROGATE_H */
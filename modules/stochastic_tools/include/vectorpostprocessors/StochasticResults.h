@@ -45,6 +45,16 @@ public:
    */
   VectorPostprocessorValue & getVectorPostprocessorValueByGroup(unsigned int group);
 
+  /**
+   * Store the value computed for a sample.
+   * @param global_index The global row of the sample (see Sampler::getLocation)
+   * @param value The value to store
+   *
+   * When "parallel_type = DISTRIBUTED" each processor stores only the rows in the range given by
+   * Sampler::getLocalRowBegin/End, values for other rows are ignored.
+   */
+  void setSampleValue(unsigned int global_index, Real value);
+
   /**
    * Get the sample vectors
    * @return A const pointer to the vector of sample vectors
@@ -60,6 +70,9 @@ protected:
 
   /// The sampler to extract data
   Sampler * _sampler = nullptr;
+
+  /// The first row of each Sampler matrix stored by this object
+  std::vector<unsigned int> _first_rows;
 };
 
 #endif
@@ -0,0 +1,84 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform_left]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 0.5
+  [../]
+  [./uniform_right]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 5
+    distributions = 'uniform_left uniform_right'
+    execute_on = INITIAL
+    parallel_type = DISTRIBUTED
+  [../]
+[]
+
+[UserObjects]
+  [./pce]
+    type = PolynomialChaos
+    from_file = pce_regression_model.txt
+    distributions = 'uniform_left uniform_right'
+  [../]
+[]
+
+[Functions]
+  [./surrogate]
+    # The model inputs are the left and right values, evaluated at the coordinates (x, y)
+    type = SurrogateFunction
+    model = pce
+    inputs = 'x y'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./evaluate]
+    type = EvaluateSurrogate
+    model = pce
+    sampler = sample
+    execute_on = timestep_end
+  [../]
+[]
+
+[Postprocessors]
+  [./value]
+    type = FunctionValuePostprocessor
+    function = surrogate
+    point = '0.25 1.5 0'
+    execute_on = timestep_end
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]
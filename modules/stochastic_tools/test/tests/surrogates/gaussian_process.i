@@ -0,0 +1,108 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform_left]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 0.5
+  [../]
+  [./uniform_right]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 10
+    distributions = 'uniform_left uniform_right'
+    execute_on = INITIAL
+    parallel_type = DISTRIBUTED
+  [../]
+[]
+
+[MultiApps]
+  [./sub]
+    type = SamplerMultiApp
+    input_files = sub.i
+    sampler = sample
+  [../]
+[]
+
+[Transfers]
+  [./runner]
+    type = SamplerTransfer
+    multi_app = sub
+    parameters = 'BCs/left/value BCs/right/value'
+    to_control = 'stochastic'
+    execute_on = INITIAL
+    check_multiapp_execute_on = false
+  [../]
+  [./data]
+    type = SamplerPostprocessorTransfer
+    multi_app = sub
+    vector_postprocessor = storage
+    postprocessor = avg
+    execute_on = timestep_begin
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./storage]
+    # Sizes the vectors before the results are transferred on timestep_begin
+    type = StochasticResults
+    execute_on = initial
+  [../]
+  [./evaluate]
+    type = EvaluateSurrogate
+    model = gp
+    sampler = sample
+    execute_on = timestep_end
+  [../]
+[]
+
+[UserObjects]
+  [./gp]
+    type = GaussianProcess
+    sampler = sample
+    results = storage
+    execute_on = timestep_end
+    length_factor = '1 1'
+    cv_folds = 5
+    filename = gaussian_process_model.txt
+  [../]
+[]
+
+[Postprocessors]
+  [./cv_error]
+    type = SurrogateCrossValidationError
+    model = gp
+    execute_on = timestep_end
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]
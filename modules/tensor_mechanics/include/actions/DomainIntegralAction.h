@@ -49,6 +49,9 @@ protected:
 
   unsigned int calcNumCrackFrontPoints();
 
+  /// Base of the names of the postprocessors reporting the given integral
+  std::string integralBaseName(INTEGRAL integral) const;
+
   std::set<INTEGRAL> _integrals;
   const std::vector<BoundaryName> & _boundary_names;
   std::vector<Point> _crack_front_points;
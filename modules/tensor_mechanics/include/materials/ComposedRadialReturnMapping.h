@@ -0,0 +1,352 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPOSEDRADIALRETURNMAPPING_H
+#define COMPOSEDRADIALRETURNMAPPING_H
+
+#include "RadialReturnStressUpdate.h"
+#include "ElasticityTensorTools.h"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <tuple>
+
+/**
+ * Interface used by ComputeMultipleInelasticStress to call a set of radial return
+ * models that have been fused into a single return mapping solve.
+ */
+class ComposedRadialReturnMappingBase
+{
+public:
+  ComposedRadialReturnMappingBase(unsigned int num_models)
+    : _iterations(0), _timing(false), _model_time(num_models, 0.0)
+  {
+  }
+
+  virtual ~ComposedRadialReturnMappingBase() {}
+
+  /**
+   * Compute the admissible stress and the inelastic strain increments of all models
+   * at the current quadrature point with a single Newton solve.
+   * @param strain_increment Upon input: the strain increment.  Upon output: the elastic strain
+   * increment
+   * @param inelastic_strain_increment The inelastic strain increment of each model
+   * @param stress_new Upon input: the trial stress.  Upon output: the admissible stress
+   * @param elasticity_tensor The elasticity tensor, which must be isotropic
+   * @param elastic_strain_old Old state of total elastic strain
+   * @param compute_tangent Whether each model should compute its tangent operator contribution
+   * @param tangent_operator The tangent operator contribution of each model
+   * @return Whether the solve converged
+   */
+  virtual bool updateState(RankTwoTensor & strain_increment,
+                           std::vector<RankTwoTensor> & inelastic_strain_increment,
+                           RankTwoTensor & stress_new,
+                           const RankFourTensor & elasticity_tensor,
+                           const RankTwoTensor & elastic_strain_old,
+                           const std::vector<bool> & compute_tangent,
+                           std::vector<RankFourTensor> & tangent_operator) = 0;
+
+  /// Number of Newton iterations taken by the last solve
+  unsigned int iterations() const { return _iterations; }
+
+  /// Enable timing of the residual and derivative evaluations of the individual models
+  void setTiming(bool timing) { _timing = timing; }
+
+  /// Time in seconds spent evaluating the given model during the last solve
+  Real modelTime(unsigned int model) const { return _model_time[model]; }
+
+protected:
+  /// Number of Newton iterations taken by the last solve
+  unsigned int _iterations;
+
+  /// Whether to time the model evaluations
+  bool _timing;
+
+  /// Time spent evaluating each model during the last solve
+  std::vector<Real> _model_time;
+};
+
+/**
+ * ComposedRadialReturnMapping solves for the scalar inelastic strain increments of a set of
+ * radial return models simultaneously.  All models share the flow direction of the deviatoric
+ * trial stress, so the effective stress after the update is
+ *   sigma = sigma_trial - 3 G sum_j scalar_j
+ * and the residual of model i is the model's own return mapping residual evaluated with the
+ * trial stress reduced by the inelastic strain increments of all the other models.
+ *
+ * The model types are template arguments, so the residuals and derivatives are called without
+ * virtual dispatch and all iteration storage is of fixed size.
+ */
+template <typename... Models>
+class ComposedRadialReturnMapping : public ComposedRadialReturnMappingBase
+{
+public:
+  static constexpr std::size_t N = sizeof...(Models);
+
+  ComposedRadialReturnMapping(Models *... models, unsigned int max_its)
+    : ComposedRadialReturnMappingBase(N), _models(models...), _max_its(max_its)
+  {
+  }
+
+  virtual bool updateState(RankTwoTensor & strain_increment,
+                           std::vector<RankTwoTensor> & inelastic_strain_increment,
+                           RankTwoTensor & stress_new,
+                           const RankFourTensor & elasticity_tensor,
+                           const RankTwoTensor & elastic_strain_old,
+                           const std::vector<bool> & compute_tangent,
+                           std::vector<RankFourTensor> & tangent_operator) override
+  {
+    const RankTwoTensor deviatoric_trial_stress = stress_new.deviatoric();
+    const Real effective_trial_stress =
+        std::sqrt(1.5 * deviatoric_trial_stress.doubleContraction(deviatoric_trial_stress));
+    _three_shear_modulus =
+        3.0 * ElasticityTensorTools::getIsotropicShearModulus(elasticity_tensor);
+
+    _iterations = 0;
+    _model_time.assign(N, 0.0);
+    initialize<0>(effective_trial_stress, elasticity_tensor);
+
+    if (!MooseUtils::absoluteFuzzyEqual(effective_trial_stress, 0.0))
+      if (!solve(effective_trial_stress))
+        return false;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      if (_scalar[i] != 0.0)
+        inelastic_strain_increment[i] =
+            deviatoric_trial_stress * (1.5 * _scalar[i] / effective_trial_stress);
+      else
+        inelastic_strain_increment[i].zero();
+      strain_increment -= inelastic_strain_increment[i];
+    }
+
+    // Like RadialReturnStressUpdate, use the old elastic strain because the elasticity
+    // tensor is required to be isotropic
+    stress_new = elasticity_tensor * (strain_increment + elastic_strain_old);
+
+    finalize<0>(effective_trial_stress,
+                inelastic_strain_increment,
+                stress_new,
+                compute_tangent,
+                tangent_operator);
+    return true;
+  }
+
+protected:
+  /// Newton iterations on the vector of scalar inelastic strain increments
+  bool solve(const Real effective_trial_stress)
+  {
+    std::array<Real, N> increment;
+    std::array<std::array<Real, N>, N> jacobian;
+
+    while (true)
+    {
+      // the trial stress seen by model i excludes its own inelastic strain increment
+      Real scalar_sum = 0.0;
+      for (std::size_t i = 0; i < N; ++i)
+        scalar_sum += _scalar[i];
+      for (std::size_t i = 0; i < N; ++i)
+        _trial_stress[i] =
+            effective_trial_stress - _three_shear_modulus * (scalar_sum - _scalar[i]);
+
+      evaluate<0>(jacobian);
+
+      // models sitting on their lower bound that would need to go below it are inactive
+      bool all_converged = true;
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        if (_scalar[i] <= _minimum[i] && _residual[i] < 0.0)
+        {
+          _residual[i] = 0.0;
+          for (std::size_t j = 0; j < N; ++j)
+            jacobian[i][j] = (i == j ? 1.0 : 0.0);
+        }
+        else if (!_converged[i])
+          all_converged = false;
+      }
+
+      if (all_converged)
+        return true;
+
+      if (_iterations == _max_its)
+        return false;
+
+      for (std::size_t i = 0; i < N; ++i)
+        increment[i] = -_residual[i];
+      if (!solveLinearSystem(jacobian, increment))
+        return false;
+
+      // damp the step to keep the effective stress positive, and project the increments
+      // onto their permissible ranges
+      Real increment_sum = 0.0;
+      for (std::size_t i = 0; i < N; ++i)
+        increment_sum += increment[i];
+      Real alpha = 1.0;
+      const Real max_scalar_sum = effective_trial_stress / _three_shear_modulus;
+      if (scalar_sum + increment_sum > max_scalar_sum)
+        alpha = 0.5 * (max_scalar_sum - scalar_sum) / increment_sum;
+
+      for (std::size_t i = 0; i < N; ++i)
+        _scalar[i] = std::max(_scalar[i] + alpha * increment[i], _minimum[i]);
+
+      ++_iterations;
+    }
+  }
+
+  /// Solve a small dense system by Gaussian elimination with partial pivoting
+  static bool solveLinearSystem(std::array<std::array<Real, N>, N> & a, std::array<Real, N> & b)
+  {
+    for (std::size_t k = 0; k < N; ++k)
+    {
+      std::size_t pivot = k;
+      for (std::size_t i = k + 1; i < N; ++i)
+        if (std::abs(a[i][k]) > std::abs(a[pivot][k]))
+          pivot = i;
+      if (a[pivot][k] == 0.0)
+        return false;
+      std::swap(a[k], a[pivot]);
+      std::swap(b[k], b[pivot]);
+
+      for (std::size_t i = k + 1; i < N; ++i)
+      {
+        const Real factor = a[i][k] / a[k][k];
+        for (std::size_t j = k; j < N; ++j)
+          a[i][j] -= factor * a[k][j];
+        b[i] -= factor * b[k];
+      }
+    }
+
+    for (std::size_t k = N; k-- > 0;)
+    {
+      for (std::size_t j = k + 1; j < N; ++j)
+        b[k] -= a[k][j] * b[j];
+      b[k] /= a[k][k];
+    }
+    return true;
+  }
+
+  ///@{ Compile time loops over the models
+  template <std::size_t I>
+  typename std::enable_if<(I < N)>::type initialize(const Real effective_trial_stress,
+                                                    const RankFourTensor & elasticity_tensor)
+  {
+    typedef typename std::tuple_element<I, std::tuple<Models...>>::type Model;
+    Model * model = std::get<I>(_models);
+
+    model->_three_shear_modulus = _three_shear_modulus;
+    model->Model::computeStressInitialize(effective_trial_stress, elasticity_tensor);
+    _scalar[I] = model->Model::initialGuess(effective_trial_stress);
+    _minimum[I] = model->Model::minimumPermissibleValue(effective_trial_stress);
+    model->_iteration = 0;
+
+    initialize<I + 1>(effective_trial_stress, elasticity_tensor);
+  }
+  template <std::size_t I>
+  typename std::enable_if<(I == N)>::type initialize(const Real, const RankFourTensor &)
+  {
+  }
+
+  template <std::size_t I>
+  typename std::enable_if<(I < N)>::type evaluate(std::array<std::array<Real, N>, N> & jacobian)
+  {
+    typedef typename std::tuple_element<I, std::tuple<Models...>>::type Model;
+    Model * model = std::get<I>(_models);
+
+    std::chrono::steady_clock::time_point start;
+    if (_timing)
+      start = std::chrono::steady_clock::now();
+
+    const Real trial_stress = _trial_stress[I];
+    _residual[I] = model->Model::computeResidual(trial_stress, _scalar[I]);
+    model->Model::iterationFinalize(_scalar[I]);
+    _converged[I] = model->Model::converged(
+        _residual[I], model->Model::computeReferenceResidual(trial_stress, _scalar[I]));
+
+    // d(residual_I)/d(scalar_j) for j != I follows from the dependence of the trial stress
+    // seen by model I on the other inelastic strain increments
+    const Real coupling = -_three_shear_modulus *
+                          model->Model::computeTrialStressDerivative(trial_stress, _scalar[I]);
+    for (std::size_t j = 0; j < N; ++j)
+      jacobian[I][j] = coupling;
+    jacobian[I][I] = model->Model::computeDerivative(trial_stress, _scalar[I]);
+    model->_iteration = _iterations;
+
+    if (_timing)
+      _model_time[I] +=
+          std::chrono::duration<Real>(std::chrono::steady_clock::now() - start).count();
+
+    evaluate<I + 1>(jacobian);
+  }
+  template <std::size_t I>
+  typename std::enable_if<(I == N)>::type evaluate(std::array<std::array<Real, N>, N> &)
+  {
+  }
+
+  template <std::size_t I>
+  typename std::enable_if<(I < N)>::type
+  finalize(const Real effective_trial_stress,
+           const std::vector<RankTwoTensor> & inelastic_strain_increment,
+           const RankTwoTensor & stress_new,
+           const std::vector<bool> & compute_tangent,
+           std::vector<RankFourTensor> & tangent_operator)
+  {
+    std::get<I>(_models)->updateStateFinalize(_scalar[I],
+                                              effective_trial_stress,
+                                              inelastic_strain_increment[I],
+                                              stress_new,
+                                              compute_tangent[I],
+                                              tangent_operator[I]);
+
+    finalize<I + 1>(effective_trial_stress,
+                    inelastic_strain_increment,
+                    stress_new,
+                    compute_tangent,
+                    tangent_operator);
+  }
+  template <std::size_t I>
+  typename std::enable_if<(I == N)>::type finalize(const Real,
+                                                   const std::vector<RankTwoTensor> &,
+                                                   const RankTwoTensor &,
+                                                   const std::vector<bool> &,
+                                                   std::vector<RankFourTensor> &)
+  {
+  }
+  ///@}
+
+  /// The composed models
+  std::tuple<Models *...> _models;
+
+  /// Maximum number of Newton iterations
+  const unsigned int _max_its;
+
+  /// 3 * shear modulus
+  Real _three_shear_modulus;
+
+  ///@{ Per-model iteration storage
+  std::array<Real, N> _scalar;
+  std::array<Real, N> _minimum;
+  std::array<Real, N> _trial_stress;
+  std::array<Real, N> _residual;
+  std::array<bool, N> _converged;
+  ///@}
+};
+
+/**
+ * Build a composed return mapping for the given models if their exact types match one of
+ * the supported compositions.
+ * @param models The inelastic models in the order in which they were given
+ * @param max_its Maximum number of Newton iterations
+ * @return The composed return mapping, or nullptr if the models cannot be composed
+ */
+std::unique_ptr<ComposedRadialReturnMappingBase>
+buildComposedRadialReturnMapping(const std::vector<StressUpdateBase *> & models,
+                                 unsigned int max_its);
+
+#endif // COMPOSEDRADIALRETURNMAPPING_H
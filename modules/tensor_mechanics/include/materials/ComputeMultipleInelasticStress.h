@@ -13,6 +13,7 @@
 #include "ComputeFiniteStrainElasticStress.h"
 
 #include "StressUpdateBase.h"
+#include "ComposedRadialReturnMapping.h"
 
 class ComputeMultipleInelasticStress;
 
@@ -75,6 +76,22 @@ protected:
   virtual void updateQpState(RankTwoTensor & elastic_strain_increment,
                              RankTwoTensor & combined_inelastic_strain_increment);
 
+  /**
+   * Given the _strain_increment[_qp], compute the admissible stress and the inelastic strain
+   * increments of all models with the single combined return mapping solve.
+   * @param elastic_strain_increment The elastic part of _strain_increment[_qp]
+   * @return Whether the combined solve converged.  If it did not, the caller falls back to
+   * iterating over the models
+   */
+  bool updateQpStateComposed(RankTwoTensor & elastic_strain_increment);
+
+  /**
+   * Form the combined inelastic strain increment from the inelastic strain increments of the
+   * models, and compute the Jacobian multiplier and the material time step limit
+   * @param combined_inelastic_strain_increment The weighted sum of the inelastic strain increments
+   */
+  void finalizeQpState(RankTwoTensor & combined_inelastic_strain_increment);
+
   /**
    * An optimised version of updateQpState that gets used when the number
    * of plastic models is unity, or when we're cycling through models
@@ -177,6 +194,24 @@ protected:
 
   /// is the elasticity tensor guaranteed to be isotropic?
   bool _is_elasticity_tensor_guaranteed_isotropic;
+
+  /// The inelastic strain increment computed by each model
+  std::vector<RankTwoTensor> _inelastic_strain_increment;
+
+  /// Whether each model computes its tangent operator in the current call
+  std::vector<bool> _compute_tangent;
+
+  /// Whether to solve for all inelastic strain increments in a single return mapping solve
+  const bool _combined_return_mapping;
+
+  /// The models combined into a single return mapping solve
+  std::unique_ptr<ComposedRadialReturnMappingBase> _composed_models;
+
+  ///@{ Return mapping iterations and time spent in each model
+  const bool _output_model_statistics;
+  std::vector<MaterialProperty<Real> *> _model_iterations;
+  std::vector<MaterialProperty<Real> *> _model_time;
+  ///@}
 };
 
 #endif // COMPUTEMULTIPLEINELASTICSTRESS_H
@@ -41,6 +41,9 @@ public:
   IsotropicPlasticityStressUpdate(const InputParameters & parameters);
 
 protected:
+  template <typename... Models>
+  friend class ComposedRadialReturnMapping;
+
   virtual void initQpStatefulProperties() override;
   virtual void propagateQpStatefulProperties() override;
 
@@ -49,6 +52,14 @@ protected:
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
   virtual void iterationFinalize(Real scalar) override;
+
+  /**
+   * Compute the derivative of the residual with respect to the effective trial stress
+   * @param effective_trial_stress Effective trial stress
+   * @param scalar                 Inelastic strain increment magnitude being solved for
+   */
+  Real computeTrialStressDerivative(const Real effective_trial_stress, const Real scalar);
+
   virtual void computeStressFinalize(const RankTwoTensor & plasticStrainIncrement) override;
 
   virtual void computeYieldStress(const RankFourTensor & elasticity_tensor);
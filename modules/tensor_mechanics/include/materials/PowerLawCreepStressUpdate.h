@@ -33,11 +33,21 @@ public:
   PowerLawCreepStressUpdate(const InputParameters & parameters);
 
 protected:
+  template <typename... Models>
+  friend class ComposedRadialReturnMapping;
+
   virtual void computeStressInitialize(const Real effective_trial_stress,
                                        const RankFourTensor & elasticity_tensor) override;
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
 
+  /**
+   * Compute the derivative of the residual with respect to the effective trial stress
+   * @param effective_trial_stress Effective trial stress
+   * @param scalar                 Inelastic strain increment magnitude being solved for
+   */
+  Real computeTrialStressDerivative(const Real effective_trial_stress, const Real scalar);
+
   /// Flag to determine if temperature is supplied by the user
   const bool _has_temp;
 
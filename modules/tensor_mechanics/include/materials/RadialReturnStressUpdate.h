@@ -81,6 +81,11 @@ public:
    */
   bool requiresIsotropicTensor() override { return true; }
 
+  /**
+   * Number of iterations taken by the last return mapping solve
+   */
+  unsigned int returnMappingIterations() const override { return _iteration; }
+
 protected:
   virtual void initQpStatefulProperties() override;
 
@@ -120,6 +125,23 @@ protected:
    */
   virtual void computeStressFinalize(const RankTwoTensor & /*inelasticStrainIncrement*/) {}
 
+  /**
+   * Update the internal state variables and compute the tangent operator once the scalar
+   * effective inelastic strain increment has been determined.
+   * @param scalar_effective_inelastic_strain Converged scalar inelastic strain increment
+   * @param effective_trial_stress        Effective trial stress
+   * @param inelastic_strain_increment    Inelastic strain increment calculated by this class
+   * @param stress_new                    Admissible stress
+   * @param compute_full_tangent_operator Whether the tangent operator should be computed
+   * @param tangent_operator              Tangent operator contribution of this class
+   */
+  void updateStateFinalize(const Real scalar_effective_inelastic_strain,
+                           const Real effective_trial_stress,
+                           const RankTwoTensor & inelastic_strain_increment,
+                           const RankTwoTensor & stress_new,
+                           bool compute_full_tangent_operator,
+                           RankFourTensor & tangent_operator);
+
   /// 3 * shear modulus
   Real _three_shear_modulus;
 
@@ -33,6 +33,9 @@ public:
   void setRelativeTolerance(Real relative_tolerance) { _relative_tolerance = relative_tolerance; }
   void setAbsoluteTolerance(Real absolute_tolerance) { _absolute_tolerance = absolute_tolerance; }
 
+  /// Whether the legacy return mapping algorithm is used
+  bool legacyReturnMapping() const { return _legacy_return_mapping; }
+
 protected:
   /**
    * Perform the return mapping iterations
@@ -120,6 +123,17 @@ protected:
   /// Whether to check to see whether iterative solution is within admissible range, and set within that range if outside
   bool _check_range;
 
+  /// Number of iterations taken by the last return mapping solve
+  unsigned int _iteration;
+
+  /**
+   * Check to see whether the residual is within the convergence limits.
+   * @param residual  Current value of the residual
+   * @param reference Current value of the reference quantity
+   * @return Whether the model converged
+   */
+  bool converged(const Real residual, const Real reference);
+
 private:
   /// Maximum number of return mapping iterations (used only in legacy return mapping)
   unsigned int _max_its;
@@ -174,14 +188,6 @@ private:
                            Real & scalar,
                            std::stringstream * iter_output);
 
-  /**
-   * Check to see whether the residual is within the convergence limits.
-   * @param residual  Current value of the residual
-   * @param reference Current value of the reference quantity
-   * @return Whether the model converged
-   */
-  bool converged(const Real residual, const Real reference);
-
   /**
    * Check to see whether the residual is within acceptable convergence limits.
    * This will only return true if it has been determined that progress is no
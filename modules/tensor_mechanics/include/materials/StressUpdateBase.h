@@ -112,6 +112,12 @@ public:
     return TangentCalculationMethod::ELASTIC;
   }
 
+  /**
+   * Number of iterations taken by the last call to updateState, for models that
+   * perform an iterative procedure
+   */
+  virtual unsigned int returnMappingIterations() const { return 0; }
+
   ///@{ Retained as empty methods to avoid a warning from Material.C in framework. These methods are unused in all inheriting classes and should not be overwritten.
   void resetQpProperties() final {}
   void resetProperties() final {}
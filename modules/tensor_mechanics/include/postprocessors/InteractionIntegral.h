@@ -34,6 +34,41 @@ public:
   static MooseEnum qFunctionType();
   static MooseEnum sifModeType();
 
+  /**
+   * Compute the plane strain auxiliary stress field and x1-derivative of the auxiliary
+   * displacement field for mixed-mode stress intensity factors, in crack front coordinates
+   * @param k unit stress intensity factors for modes I, II and III
+   * @param r distance from the crack front
+   * @param theta angle relative to the crack direction
+   * @param poissons_ratio Poisson's ratio
+   * @param shear_modulus shear modulus
+   * @param[out] aux_stress auxiliary stress
+   * @param[out] grad_disp x1-derivative of the auxiliary displacements (first row)
+   */
+  static void auxiliaryFieldsK(const RealVectorValue & k,
+                               Real r,
+                               Real theta,
+                               Real poissons_ratio,
+                               Real shear_modulus,
+                               RankTwoTensor & aux_stress,
+                               RankTwoTensor & grad_disp);
+
+  /**
+   * Compute the auxiliary fields used to extract the T-stress, in crack front coordinates
+   * @param r distance from the crack front
+   * @param theta angle relative to the crack direction
+   * @param poissons_ratio Poisson's ratio
+   * @param youngs_modulus Young's modulus
+   * @param[out] aux_stress auxiliary stress
+   * @param[out] grad_disp x1-derivative of the auxiliary displacements (first row)
+   */
+  static void auxiliaryFieldsT(Real r,
+                               Real theta,
+                               Real poissons_ratio,
+                               Real youngs_modulus,
+                               RankTwoTensor & aux_stress,
+                               RankTwoTensor & grad_disp);
+
 protected:
   virtual void initialSetup();
   virtual Real computeQpIntegral();
@@ -59,7 +94,6 @@ protected:
   std::vector<Real> _q_curr_elem;
   const std::vector<std::vector<Real>> * _phi_curr_elem;
   const std::vector<std::vector<RealGradient>> * _dphi_curr_elem;
-  Real _kappa;
   Real _shear_modulus;
   Real _r;
   Real _theta;
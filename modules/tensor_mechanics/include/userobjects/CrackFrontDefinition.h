@@ -13,7 +13,12 @@
 #include "GeneralUserObject.h"
 #include "CrackFrontPointsProvider.h"
 #include "BoundaryRestrictable.h"
+#include "KDTree.h"
+
+#include "libmesh/threads.h"
+
 #include <set>
+#include <unordered_map>
 
 class CrackFrontDefinition;
 class AuxiliarySystem;
@@ -54,6 +59,8 @@ public:
   Real getAngleAlongFront(const unsigned int point_index) const;
   unsigned int getNumCrackFrontPoints() const;
   bool treatAs2D() const { return _treat_as_2d; }
+  /// Whether the integration domains are defined by rings of elements rather than radii
+  bool usingTopologicalQFunction() const { return _q_function_type == "TOPOLOGY"; }
   RealVectorValue rotateToCrackFrontCoords(const RealVectorValue vector,
                                            const unsigned int point_index) const;
   RankTwoTensor rotateToCrackFrontCoords(const RankTwoTensor tensor,
@@ -95,6 +102,15 @@ public:
                                           unsigned int ring_index,
                                           const Node * const current_node) const;
 
+  /**
+   * Get the indices of the crack front points whose q-function is nonzero on an element for at
+   * least one ring. These are computed the first time an element is queried and cached until the
+   * crack front geometry is updated
+   * @param elem the element
+   * @return the indices of the crack front points, in increasing order
+   */
+  const std::vector<unsigned int> & getElemCrackFrontPoints(const Elem * elem) const;
+
 protected:
   enum DIRECTION_METHOD
   {
@@ -169,6 +185,21 @@ protected:
   const CrackFrontPointsProvider * _crack_front_points_provider;
   unsigned int _num_points_from_provider;
 
+  /// Crack front points with a nonzero q-function on each element that has been queried
+  mutable std::unordered_map<dof_id_type, std::vector<unsigned int>> _elem_crack_front_points;
+  /// Mutex protecting the element to crack front point cache
+  mutable Threads::spin_mutex _elem_crack_front_points_mutex;
+  /// Crack front points whose outermost topological q-function ring contains each node
+  std::unordered_map<dof_id_type, std::vector<unsigned int>> _node_crack_front_points;
+  /// Copy of the crack front point coordinates indexed by _crack_front_point_tree
+  std::vector<Point> _crack_front_point_coords;
+  /// Spatial index of the crack front points whose geometric q-function has a bounded support
+  std::unique_ptr<KDTree> _crack_front_point_tree;
+  /// Crack front points whose geometric q-function is not truncated along the crack front
+  std::vector<unsigned int> _untruncated_crack_front_points;
+  /// Largest distance from a crack front point in _crack_front_point_tree to its q-function support
+  Real _crack_front_point_search_radius;
+
   void getCrackFrontNodes(std::set<dof_id_type> & nodes);
   void orderCrackFrontNodes(std::set<dof_id_type> & nodes);
   void orderEndNodes(std::vector<dof_id_type> & end_nodes);
@@ -191,6 +222,14 @@ protected:
                                const std::set<dof_id_type> & nodes_neighbor1,
                                const std::set<dof_id_type> & nodes_neighbor2,
                                std::vector<std::vector<const Elem *>> & nodes_to_elem_map);
+  /**
+   * Find the crack front points with a nonzero q-function on an element
+   * @param elem the element
+   * @param[out] points the indices of the crack front points
+   */
+  void computeElemCrackFrontPoints(const Elem * elem, std::vector<unsigned int> & points) const;
+  /// Build the spatial index used to find the crack front points near an element
+  void buildCrackFrontPointSearch();
   void projectToFrontAtPoint(Real & dist_to_front,
                              Real & dist_along_tangent,
                              unsigned int crack_front_point_index,
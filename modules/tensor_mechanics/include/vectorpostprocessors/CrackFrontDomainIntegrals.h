@@ -0,0 +1,119 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef CRACKFRONTDOMAININTEGRALS_H
+#define CRACKFRONTDOMAININTEGRALS_H
+
+#include "ElementVectorPostprocessor.h"
+#include "CrackFrontDefinition.h"
+
+#include "libmesh/fe_base.h"
+
+// Forward Declarations
+class CrackFrontDomainIntegrals;
+class RankTwoTensor;
+
+template <>
+InputParameters validParams<CrackFrontDomainIntegrals>();
+
+/**
+ * Computes the J-integral and/or the interaction integrals for all points along a
+ * crack front and all rings of integration domains in a single loop over the elements.
+ * Only the crack front points whose q-functions are nonzero on an element (as cached
+ * by the CrackFrontDefinition) are visited, and the fields that depend only on the
+ * crack front point are evaluated once per quadrature point and reused for all rings.
+ * Produces the same values as the JIntegral and InteractionIntegral postprocessors.
+ */
+class CrackFrontDomainIntegrals : public ElementVectorPostprocessor
+{
+public:
+  CrackFrontDomainIntegrals(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// The domain integrals that can be computed
+  enum class IntegralType
+  {
+    J,
+    KI,
+    KII,
+    KIII,
+    T
+  };
+
+  /// Accumulate the contributions of one crack front point on the current element
+  void integrateCrackFrontPoint(unsigned int point_index);
+
+  /// Index of the integral and ring in _integral_values and _integral_vectors
+  unsigned int valueIndex(unsigned int integral_index, unsigned int ring_index) const
+  {
+    return integral_index * _rings.size() + ring_index;
+  }
+
+  const CrackFrontDefinition & _crack_front_definition;
+
+  /// Integrals to compute
+  std::vector<IntegralType> _integrals;
+  /// Whether any interaction integral is requested
+  bool _has_interaction_integral;
+  /// Whether the J-integral is requested
+  bool _has_j_integral;
+
+  /// Ring IDs of the integration domains
+  const std::vector<unsigned int> _rings;
+  /// Offset between ring IDs and ring indices in the CrackFrontDefinition
+  unsigned int _ring_base;
+  /// Whether the CrackFrontDefinition uses the topological q-function
+  const bool _topological_q;
+
+  bool _treat_as_2d;
+  const bool _convert_J_to_K;
+  const bool _has_symmetry_plane;
+  const Real _poissons_ratio;
+  const Real _youngs_modulus;
+  const MooseEnum _position_type;
+
+  /// Number of displacement variables
+  const unsigned int _ndisp;
+  /// Gradients of the displacements
+  std::vector<const VariableGradient *> _grad_disp;
+  const bool _has_temp;
+  const VariableGradient & _grad_temp;
+
+  const MaterialProperty<RankTwoTensor> * _Eshelby_tensor;
+  const MaterialProperty<RealVectorValue> * _J_thermal_term_vec;
+  const MaterialProperty<RankTwoTensor> * _stress;
+  const MaterialProperty<RankTwoTensor> * _strain;
+  const MaterialProperty<RankTwoTensor> * _total_deigenstrain_dT;
+
+  /// First order Lagrange shape functions used to interpolate q
+  std::unique_ptr<FEBase> _fe;
+  const std::vector<std::vector<Real>> & _phi_q;
+  const std::vector<std::vector<RealGradient>> & _dphi_q;
+
+  /// Nodal values of q for each ring on the current element
+  std::vector<std::vector<Real>> _q_nodal;
+
+  /// Partial sums of the integrals, indexed by valueIndex() and crack front point
+  std::vector<std::vector<Real>> _integral_values;
+
+  VectorPostprocessorValue & _x;
+  VectorPostprocessorValue & _y;
+  VectorPostprocessorValue & _z;
+  VectorPostprocessorValue & _position;
+  /// Output vectors, indexed by valueIndex()
+  std::vector<VectorPostprocessorValue *> _integral_vectors;
+};
+
+#endif // CRACKFRONTDOMAININTEGRALS_H
@@ -177,6 +177,17 @@ public:
   Xfem::XFEM_QRULE & getXFEMQRule();
   void setXFEMQRule(std::string & xfem_qrule);
   void setCrackGrowthMethod(bool use_crack_growth_increment, Real crack_growth_increment);
+  /**
+   * Set the number of layers of neighbors around the newly cut and crack tip elements that are
+   * processed by the element fragment algorithm in each cut (0 to process all elements)
+   */
+  void setCutFrontUpdateLayers(unsigned int layers);
+  /**
+   * Set the amount of output about the mesh modifications: 0 for none, 1 for the elements and
+   * nodes that are added and deleted, 2 to also report the number of elements processed by the
+   * element fragment algorithm
+   */
+  void setDebugOutputLevel(unsigned int level) { _debug_output_level = level; }
   virtual bool getXFEMWeights(MooseArray<Real> & weights,
                               const Elem * elem,
                               QBase * qrule,
@@ -260,6 +271,9 @@ private:
   bool _use_crack_growth_increment;
   Real _crack_growth_increment;
 
+  /// Amount of output about the mesh modifications
+  unsigned int _debug_output_level;
+
   std::vector<const GeometricCutUserObject *> _geometric_cuts;
 
   std::map<unique_id_type, XFEMCutElem *> _cut_elem_map;
@@ -387,6 +401,23 @@ private:
    * @param sys  System for which the dof indices are found
    */
   std::vector<dof_id_type> getNodeSolutionDofs(const Node * node, SystemBase & sys) const;
+
+  /**
+   * Compute parallel-consistent ids and unique ids for the elements and nodes created by a cut on
+   * a distributed mesh.  The EFA numbering of the children and new nodes depends on the elements
+   * that are present on each processor, so the children are matched across processors by their
+   * parent and the existing mesh nodes they keep.  The owner of each parent element reports its
+   * children, and the owner of the parent of the child that creates each new node reports that
+   * node.  The ids are assigned in the same order as on a replicated mesh.
+   * @param new_elements EFA child elements created by the cut
+   * @param new_nodes EFA nodes created by the cut
+   * @param new_elem_ids Map from EFA child element ids to the new element ids and unique ids
+   * @param new_node_ids Map from EFA node ids to the new node ids and unique ids
+   */
+  void computeNewIds(const std::vector<EFAElement *> & new_elements,
+                     const std::vector<EFANode *> & new_nodes,
+                     std::map<unsigned int, std::pair<dof_id_type, unique_id_type>> & new_elem_ids,
+                     std::map<unsigned int, std::pair<dof_id_type, unique_id_type>> & new_node_ids);
 };
 
 #endif // XFEM_H
@@ -42,6 +42,16 @@ private:
   std::vector<EFAElement *> _child_elements;
   std::vector<EFAElement *> _parent_elements;
   std::map<EFANode *, std::set<EFAElement *>> _inverse_connectivity;
+  /// Layers of neighbors around the cut front included in updates (0 to update all elements)
+  unsigned int _update_region_layers;
+  /// Elements that received new intersections since the last topology update
+  std::set<EFAElement *> _newly_cut_elements;
+  /// Elements processed by the current fragment and topology update, in order of id
+  std::vector<EFAElement *> _update_region;
+  /// Number of elements processed by the last topology update
+  unsigned int _num_updated_elements;
+
+  void buildUpdateRegion();
 
 public:
   unsigned int add2DElements(std::vector<std::vector<unsigned int>> & quads);
@@ -87,6 +97,14 @@ public:
   EFAElement * getElemByID(unsigned int id);
   unsigned int getElemIdByNodes(unsigned int * node_id);
   void clearPotentialIsolatedNodes();
+
+  /**
+   * Restrict fragment and child element updates to the newly cut elements, the crack tip
+   * elements, and the given number of layers of their neighbors
+   * @param layers Number of layers of neighbors, or 0 to update all elements
+   */
+  void setUpdateRegionLayers(unsigned int layers) { _update_region_layers = layers; }
+  unsigned int numUpdatedElements() const { return _num_updated_elements; }
 };
 
 #endif // #ifndef ELEMENTFRAGMENTALGORITHM_H
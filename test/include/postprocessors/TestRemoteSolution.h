@@ -0,0 +1,56 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef TESTREMOTESOLUTION_H
+#define TESTREMOTESOLUTION_H
+
+#include "GeneralPostprocessor.h"
+#include "MeshChangedInterface.h"
+
+class TestRemoteSolution;
+
+template <>
+InputParameters validParams<TestRemoteSolution>();
+
+/**
+ * A postprocessor for testing sparse remote dof access.  Every processor requests every dof of
+ * the system and checks the summed remote values against the serialized solution.
+ */
+class TestRemoteSolution : public GeneralPostprocessor, public MeshChangedInterface
+{
+public:
+  TestRemoteSolution(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override;
+
+  /**
+   * Sum up all requested entries and compare against the serialized solution
+   */
+  virtual void execute() override;
+
+  virtual Real getValue() override;
+
+protected:
+  /// Register all dofs of the test system as remote dofs
+  void requestDofs();
+
+  /// The system to be tested
+  SystemBase & _test_sys;
+
+  /// Reference to the serialized solution for the test system
+  NumericVector<Number> & _serialized_solution;
+
+  /// Sum of all of the entries obtained through the remote solution
+  Real _sum;
+};
+
+#endif
@@ -0,0 +1,38 @@
+# Tests the VectorPostprocessorComponent post-processor, which reports one
+# component of a vector computed by a vector post-processor.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[VectorPostprocessors]
+  [./constant]
+    type = ConstantVectorPostprocessor
+    value = '1.5 2.7 3.9'
+  [../]
+[]
+
+[Postprocessors]
+  # post-processor value being tested; value should be the second component, 2.7
+  [./component]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = constant
+    vector_name = value
+    index = 1
+  [../]
+[]
+
+[Outputs]
+  show = component
+  csv = true
+[]
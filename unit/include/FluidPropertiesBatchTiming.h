@@ -0,0 +1,151 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef FLUIDPROPERTIESBATCHTIMING_H
+#define FLUIDPROPERTIESBATCHTIMING_H
+
+#include "gtest/gtest.h"
+
+#include "FluidPropertiesBatch.h"
+
+#include <chrono>
+
+/**
+ * Utilities comparing the time taken to evaluate density, internal energy, enthalpy and
+ * viscosity (and their derivatives) through the individual property methods with the time
+ * taken by the batched evaluation of the same points.  Both times (in microseconds, summed
+ * over all repeats) are recorded as properties of the current test, so that they appear in
+ * the XML output of the unit tests.  The evaluated values are summed, which checks that both
+ * paths agree and keeps the compiler from optimizing the evaluations away.
+ */
+namespace FluidPropertiesBatchTiming
+{
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * Builds a regular grid of (p, T) points
+ * @param p_min, p_max pressure range
+ * @param T_min, T_max temperature range
+ * @param n number of points in each direction
+ * @param[out] p, T pressure and temperature of the n * n points
+ */
+inline void
+grid(Real p_min,
+     Real p_max,
+     Real T_min,
+     Real T_max,
+     unsigned int n,
+     std::vector<Real> & p,
+     std::vector<Real> & T)
+{
+  p.clear();
+  T.clear();
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int j = 0; j < n; ++j)
+    {
+      p.push_back(p_min + (p_max - p_min) * i / (n - 1));
+      T.push_back(T_min + (T_max - T_min) * j / (n - 1));
+    }
+}
+
+/// Records the individual and batched evaluation times and compares the evaluated values
+inline void
+record(Clock::duration individual_time,
+       Clock::duration batch_time,
+       Real individual_sum,
+       Real batch_sum)
+{
+  EXPECT_NEAR(batch_sum, individual_sum, 1.0e-10 * std::abs(individual_sum));
+
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  ::testing::Test::RecordProperty(
+      "individual_us", static_cast<int>(duration_cast<microseconds>(individual_time).count()));
+  ::testing::Test::RecordProperty(
+      "batch_us", static_cast<int>(duration_cast<microseconds>(batch_time).count()));
+}
+
+/// Times SinglePhaseFluidPropertiesPT::batch_dpT() against the individual *_dpT() methods
+template <typename FP>
+void
+timeBatch_dpT(const FP & fp,
+              const std::vector<Real> & p,
+              const std::vector<Real> & T,
+              unsigned int repeats)
+{
+  Real rho, drho_dp, drho_dT, e, de_dp, de_dT, h, dh_dp, dh_dT, mu, dmu_dp, dmu_dT;
+
+  Real individual_sum = 0.0;
+  const auto individual_start = Clock::now();
+  for (unsigned int r = 0; r < repeats; ++r)
+    for (std::size_t i = 0; i < p.size(); ++i)
+    {
+      fp.rho_dpT(p[i], T[i], rho, drho_dp, drho_dT);
+      fp.e_dpT(p[i], T[i], e, de_dp, de_dT);
+      fp.h_dpT(p[i], T[i], h, dh_dp, dh_dT);
+      fp.mu_dpT(p[i], T[i], mu, dmu_dp, dmu_dT);
+      individual_sum += rho + e + h + mu;
+    }
+  const auto individual_time = Clock::now() - individual_start;
+
+  FluidPropertiesBatch batch;
+  Real batch_sum = 0.0;
+  const auto batch_start = Clock::now();
+  for (unsigned int r = 0; r < repeats; ++r)
+  {
+    fp.batch_dpT(p, T, FluidPropertiesBatch::ALL, batch);
+    for (std::size_t i = 0; i < p.size(); ++i)
+      batch_sum += batch.rho[i] + batch.e[i] + batch.h[i] + batch.mu[i];
+  }
+  const auto batch_time = Clock::now() - batch_start;
+
+  record(individual_time, batch_time, individual_sum, batch_sum);
+}
+
+/// Times MultiComponentFluidPropertiesPT::batch_dpTx() against the individual *_dpTx() methods
+template <typename FP>
+void
+timeBatch_dpTx(const FP & fp,
+               const std::vector<Real> & p,
+               const std::vector<Real> & T,
+               const std::vector<Real> & x,
+               unsigned int repeats)
+{
+  Real rho, drho_dp, drho_dT, drho_dx, e, de_dp, de_dT, de_dx;
+  Real h, dh_dp, dh_dT, dh_dx, mu, dmu_dp, dmu_dT, dmu_dx;
+
+  Real individual_sum = 0.0;
+  const auto individual_start = Clock::now();
+  for (unsigned int r = 0; r < repeats; ++r)
+    for (std::size_t i = 0; i < p.size(); ++i)
+    {
+      fp.rho_dpTx(p[i], T[i], x[i], rho, drho_dp, drho_dT, drho_dx);
+      fp.e_dpTx(p[i], T[i], x[i], e, de_dp, de_dT, de_dx);
+      fp.h_dpTx(p[i], T[i], x[i], h, dh_dp, dh_dT, dh_dx);
+      fp.mu_dpTx(p[i], T[i], x[i], mu, dmu_dp, dmu_dT, dmu_dx);
+      individual_sum += rho + e + h + mu;
+    }
+  const auto individual_time = Clock::now() - individual_start;
+
+  FluidPropertiesBatch batch;
+  Real batch_sum = 0.0;
+  const auto batch_start = Clock::now();
+  for (unsigned int r = 0; r < repeats; ++r)
+  {
+    fp.batch_dpTx(p, T, x, FluidPropertiesBatch::ALL, batch);
+    for (std::size_t i = 0; i < p.size(); ++i)
+      batch_sum += batch.rho[i] + batch.e[i] + batch.h[i] + batch.mu[i];
+  }
+  const auto batch_time = Clock::now() - batch_start;
+
+  record(individual_time, batch_time, individual_sum, batch_sum);
+}
+}
+
+#endif // FLUIDPROPERTIESBATCHTIMING_H